@@ -0,0 +1,269 @@
+#include <vector>
+#include "Arduino.h"
+#include "Benchmarks.h"
+#include "PixelBuffer.h"
+#include "LightStyle.h"
+#include "HueWheel.h"
+
+#ifdef BENCHMARKS_COUNT_ALLOCATIONS
+static volatile unsigned long s_allocationCount = 0;
+
+void* operator new(size_t size) {
+  s_allocationCount++;
+  return malloc(size);
+}
+
+void* operator new[](size_t size) {
+  s_allocationCount++;
+  return malloc(size);
+}
+
+void operator delete(void* p) {
+  free(p);
+}
+
+void operator delete[](void* p) {
+  free(p);
+}
+
+void operator delete(void* p, size_t size) {
+  free(p);
+}
+
+void operator delete[](void* p, size_t size) {
+  free(p);
+}
+
+static unsigned long getAllocationCount() {
+  return s_allocationCount;
+}
+#else
+static unsigned long getAllocationCount() {
+  return 0;
+}
+#endif
+
+Benchmarks::Benchmarks(PixelBuffer* pixelBuffer, unsigned int iterations) {
+  m_pixelBuffer = pixelBuffer;
+  m_iterations = iterations;
+}
+
+void Benchmarks::runShiftBenchmarks() {
+  Serial.println("Running PixelBuffer benchmarks...");
+  benchmarkShift("shiftLineRight", &PixelBuffer::shiftLineRight);
+  benchmarkShift("shiftLineLeft", &PixelBuffer::shiftLineLeft);
+  benchmarkCopyingLineShift();
+  benchmarkShift("shiftColumnsRight", &PixelBuffer::shiftColumnsRight);
+  benchmarkShift("shiftColumnsLeft", &PixelBuffer::shiftColumnsLeft);
+  benchmarkShift("shiftRowsUp", &PixelBuffer::shiftRowsUp);
+  benchmarkShift("shiftRowsDown", &PixelBuffer::shiftRowsDown);
+  benchmarkShift("shiftDigitsRight", &PixelBuffer::shiftDigitsRight);
+  benchmarkShift("shiftDigitsLeft", &PixelBuffer::shiftDigitsLeft);
+  benchmarkSolidFill();
+  benchmarkRenderFrame(false);
+  benchmarkRenderFrame(true);
+  benchmarkHueConversion(false);
+  benchmarkHueConversion(true);
+}
+
+void Benchmarks::runStyleBenchmarks(const std::vector<LightStyle*>& styles) {
+  Serial.println("Running LightStyle benchmarks...");
+  for (int i = 0; i < styles.size(); i++) {
+    LightStyle* style = styles[i];
+    style->setSpeed(100);
+    style->setStep(50);
+    for (int pattern = 0; pattern < LightStyle::knownPatterns.size(); pattern++) {
+      style->setPattern(pattern);
+      benchmarkReset(style);
+      benchmarkUpdate(style);
+    }
+  }
+}
+
+bool Benchmarks::runAllocationCheck(const std::vector<LightStyle*>& styles) {
+  bool isAllocationFree = true;
+#ifdef BENCHMARKS_COUNT_ALLOCATIONS
+  Serial.println("Checking steady-state frame allocations...");
+
+  // With dithering on, every frame is sent even if the style left the pixels alone,
+  // and waiting for each frame means none of the displayPixels() calls return early.
+  bool wasDithered = m_pixelBuffer->m_isDithered;
+  m_pixelBuffer->setDithering(true);
+  for (int i = 0; i < styles.size(); i++) {
+    LightStyle* style = styles[i];
+    style->setSpeed(100);
+    style->setStep(50);
+    for (int pattern = 0; pattern < LightStyle::knownPatterns.size(); pattern++) {
+      style->setPattern(pattern);
+      style->reset();
+      uint32_t startFrames = m_pixelBuffer->m_frameCount;
+      unsigned long startAllocations = getAllocationCount();
+      for (unsigned int frame = 0; frame < m_iterations; frame++) {
+        m_pixelBuffer->waitForFrame();
+        style->update();
+        m_pixelBuffer->displayPixels();
+      }
+
+      unsigned long allocations = getAllocationCount() - startAllocations;
+      uint32_t frames = m_pixelBuffer->m_frameCount - startFrames;
+      bool isPassing = allocations == 0 && frames == m_iterations;
+      if (!isPassing) {
+        isAllocationFree = false;
+      }
+
+      Serial.print(isPassing ? "PASS: " : "FAIL: ");
+      Serial.print(style->getName());
+      Serial.print(" ");
+      Serial.print(LightStyle::knownPatterns[pattern]);
+      Serial.print(" made ");
+      Serial.print(allocations);
+      Serial.print(" allocations in ");
+      Serial.print(frames);
+      Serial.println(" frames.");
+    }
+  }
+
+  m_pixelBuffer->setDithering(wasDithered);
+#endif
+  return isAllocationFree;
+}
+
+void Benchmarks::benchmarkShift(const char* name, void (PixelBuffer::*shift)(uint32_t)) {
+  unsigned long startWrites = m_pixelBuffer->getPixelWriteCount();
+  unsigned long startAllocations = getAllocationCount();
+  unsigned long start = micros();
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    (m_pixelBuffer->*shift)(i);
+  }
+
+  unsigned long elapsed = micros() - start;
+  report(name, elapsed, m_iterations,
+    m_pixelBuffer->getPixelWriteCount() - startWrites,
+    getAllocationCount() - startAllocations);
+}
+
+void Benchmarks::benchmarkCopyingLineShift() {
+  // The line shift as it was before the ring buffer: every pixel moves on every shift.
+  // Kept as a reference point for shiftLineRight.
+  unsigned int pixelCount = m_pixelBuffer->getPixelCount();
+  uint32_t* pixels = new uint32_t[pixelCount]();
+  unsigned long start = micros();
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    memmove(pixels + 1, pixels, (pixelCount - 1) * sizeof(uint32_t));
+    pixels[0] = i;
+  }
+
+  unsigned long elapsed = micros() - start;
+  delete[] pixels;
+  report("copying line shift (reference)", elapsed, m_iterations, (unsigned long)m_iterations * pixelCount, 0);
+}
+
+void Benchmarks::benchmarkRenderFrame(bool isDithered) {
+  bool wasDithered = m_pixelBuffer->m_isDithered;
+  m_pixelBuffer->setDithering(isDithered);
+  unsigned long start = micros();
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    m_pixelBuffer->renderFrame();
+  }
+
+  unsigned long elapsed = micros() - start;
+  m_pixelBuffer->setDithering(wasDithered);
+  report(isDithered ? "renderFrame (dithered)" : "renderFrame", elapsed, m_iterations,
+    (unsigned long)m_iterations * m_pixelBuffer->getPixelCount(), 0);
+}
+
+void Benchmarks::benchmarkHueConversion(bool useHueWheel) {
+  // Mirrors the rainbow reset for the line patterns: one hue conversion and write per pixel.
+  // ColorHSV is how the rainbow colors were computed before the hue wheel table.
+  unsigned long startWrites = m_pixelBuffer->getPixelWriteCount();
+  unsigned long start = micros();
+  uint16_t hue = 0;
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    for (int p = m_pixelBuffer->getPixelCount() - 1; p >= 0; p--) {
+      m_pixelBuffer->setPixel(p, useHueWheel ? HueWheel::getColor(hue) : Adafruit_NeoPixel::ColorHSV(hue));
+      hue += 500;
+    }
+  }
+
+  unsigned long elapsed = micros() - start;
+  report(useHueWheel ? "rainbow line reset (HueWheel)" : "rainbow line reset (ColorHSV)", elapsed, m_iterations,
+    m_pixelBuffer->getPixelWriteCount() - startWrites, 0);
+}
+
+void Benchmarks::benchmarkSolidFill() {
+  // Mirrors the "Solid" pattern in LightStyle::shiftColorUsingPattern.
+  unsigned long startWrites = m_pixelBuffer->getPixelWriteCount();
+  unsigned long startAllocations = getAllocationCount();
+  unsigned long start = micros();
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    for (int p = 0; p < m_pixelBuffer->getPixelCount(); p++) {
+      m_pixelBuffer->setPixel(p, i);
+    }
+  }
+
+  unsigned long elapsed = micros() - start;
+  report("Solid", elapsed, m_iterations,
+    m_pixelBuffer->getPixelWriteCount() - startWrites,
+    getAllocationCount() - startAllocations);
+}
+
+void Benchmarks::benchmarkReset(LightStyle* style) {
+  unsigned long startWrites = m_pixelBuffer->getPixelWriteCount();
+  unsigned long startAllocations = getAllocationCount();
+  unsigned long start = micros();
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    style->reset();
+  }
+
+  unsigned long elapsed = micros() - start;
+  unsigned long pixelWrites = m_pixelBuffer->getPixelWriteCount() - startWrites;
+  unsigned long allocations = getAllocationCount() - startAllocations;
+
+  // The name allocates, so it's only built once the counts are taken.
+  String name = style->getName();
+  name.concat(" reset ");
+  name.concat(LightStyle::knownPatterns[style->getPattern()]);
+  report(name, elapsed, m_iterations, pixelWrites, allocations);
+}
+
+void Benchmarks::benchmarkUpdate(LightStyle* style) {
+  // A single update is far shorter than a tick of micros(), so time them in one batch.
+  // Free-running, every call does a step of work instead of waiting out the speed's delay.
+  style->setFreeRunning(true);
+  unsigned long startWrites = m_pixelBuffer->getPixelWriteCount();
+  unsigned long startAllocations = getAllocationCount();
+  unsigned long start = micros();
+  for (unsigned int i = 0; i < m_iterations; i++) {
+    style->update();
+  }
+
+  unsigned long elapsed = micros() - start;
+  unsigned long pixelWrites = m_pixelBuffer->getPixelWriteCount() - startWrites;
+  unsigned long allocations = getAllocationCount() - startAllocations;
+  style->setFreeRunning(false);
+
+  String name = style->getName();
+  name.concat(" update ");
+  name.concat(LightStyle::knownPatterns[style->getPattern()]);
+  report(name, elapsed, m_iterations, pixelWrites, allocations);
+}
+
+void Benchmarks::report(String name, unsigned long elapsedMicros, unsigned long calls, unsigned long pixelWrites, unsigned long allocations) {
+  Serial.print(name);
+  if (calls == 0) {
+    Serial.println(": no work done");
+    return;
+  }
+
+  Serial.print(": ");
+  Serial.print(calls);
+  Serial.print(" calls; ns/call: ");
+  Serial.print(elapsedMicros * 1000.0 / calls);
+  Serial.print("; pixels written/call: ");
+  Serial.print((double)pixelWrites / calls);
+#ifdef BENCHMARKS_COUNT_ALLOCATIONS
+  Serial.print("; allocations/call: ");
+  Serial.print((double)allocations / calls);
+#endif
+  Serial.println();
+}
@@ -0,0 +1,43 @@
+#include <vector>
+#include "Arduino.h"
+#include "PixelBuffer.h"
+#include "LightStyle.h"
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+// Uncomment to count heap allocations made while the benchmarks run.
+// This replaces the global operator new/delete, so leave it off for normal builds.
+//#define BENCHMARKS_COUNT_ALLOCATIONS
+
+class Benchmarks {
+  public:
+    Benchmarks(PixelBuffer* pixelBuffer, unsigned int iterations);
+
+    // Times each of the PixelBuffer shift primitives and the solid fill.
+    void runShiftBenchmarks();
+
+    // Times reset() and update() for every style with every known pattern.
+    void runStyleBenchmarks(const std::vector<LightStyle*>& styles);
+
+    // Checks that a steady-state frame (style update plus display) makes no heap allocations.
+    // Waits for every frame, so on the board this takes a frame period per iteration.
+    // Only reports results when BENCHMARKS_COUNT_ALLOCATIONS is defined.
+    // Returns false if any style and pattern allocated, or didn't send a frame every iteration.
+    bool runAllocationCheck(const std::vector<LightStyle*>& styles);
+
+  private:
+    PixelBuffer* m_pixelBuffer;
+    unsigned int m_iterations;
+
+    void benchmarkShift(const char* name, void (PixelBuffer::*shift)(uint32_t));
+    void benchmarkCopyingLineShift();
+    void benchmarkSolidFill();
+    void benchmarkRenderFrame(bool isDithered);
+    void benchmarkHueConversion(bool useHueWheel);
+    void benchmarkReset(LightStyle* style);
+    void benchmarkUpdate(LightStyle* style);
+    void report(String name, unsigned long elapsedMicros, unsigned long calls, unsigned long pixelWrites, unsigned long allocations);
+};
+
+#endif
@@ -2,12 +2,22 @@
 #include <ArduinoBLE.h>
 #include <vector>
 #include "PixelBuffer.h"
+#include "PixelLayer.h"
+#include "StyleTransition.h"
 #include "LightStyle.h"
 #include "SingleColorStyle.h"
 #include "TwoColorStyle.h"
 #include "RainbowStyle.h"
+#include "RainbowWaveStyle.h"
+#include "TwoColorWaveStyle.h"
+#include "LiveStyle.h"
+#include "FrameStream.h"
+#include "StyleCatalogue.h"
 #include "Bluetooth.h"
 #include "ManualSelection.h"
+#include "SettingsStore.h"
+#include "Benchmarks.h"
+#include "LoopProfiler.h"
 
 // Input-Output pin assignments
 #define DATA_OUT 25           // GPIO pin # (NOT Digital pin #) controlling the NeoPixels
@@ -16,17 +26,28 @@
 // Initial default values for LED styles
 #define DEFAULTSTYLE 0        // The default style to start with. This is an index into the lightStyles vector.
 #define DEFAULTBRIGHTNESS 255 // Brightness should be between 0 and 255.
+#define GAMMACORRECTION true  // Gamma-correct the colors sent to the LEDs.
+#define DITHERING false       // Temporally dither the colors sent to the LEDs to smooth low-brightness fades.
 #define DEFAULTSPEED 100       // Speed should be between 1 and 100.
 #define DEFAULTSTEP  100       // Step should be between 1 and 100.
 #define DEFAULTPATTERN 6      // Default patern (ie, Row/Column/Digit/etc). This is an index into the LightStyle::knownPatterns vector.
 
+// Frame timing
+#define FRAMERATE 60           // The maximum number of frames per second sent to the LEDs.
+#define SHOWGUARDINTERVAL 10   // The time (in msec) after starting to send a frame during which BLE is not read.
+#define TRANSITIONTIME 500     // The time (in msec) to cross-fade when the style or pattern changes. 0 turns it off.
+
+// Saved settings
+#define SETTINGSSAVEDELAY 2000 // The time (in msec) the settings have to stay the same before they're saved to flash.
+
 // Batter power monitoring
 #define LOWPOWERTHRESHOLD 6.0     // The voltage below which the system will go into "low power" mode.
 #define NORMALPOWERTHRESHOLD 6.9  // The voltage above which the system will recover from "low power" mode.
 
 // Debugging info
-#define INITIALDELAY 500      // Startup delay for debugging.
+#define INITIALDELAY 0        // Startup delay for debugging. Set to ~500 to catch the startup messages on the serial monitor.
 #define TELEMETRYINTERVAL 2000    // The amount of time (in msec) between timing calculations.
+#define BENCHMARKITERATIONS 0     // If non-zero, run the performance benchmarks at startup with this many iterations.
 
 // Manual style button configuration.
 // The input/output pin numbers are the Digital pin numbers.
@@ -40,8 +61,15 @@ Bluetooth btService;
 
 // Pixel and color data
 PixelBuffer pixelBuffer(DATA_OUT);
+PixelLayer lowPowerLayer(BlendMode::Over); // Covers the current style while in low power mode.
+StyleTransition styleTransition(&pixelBuffer);
+FrameStream frameStream;                   // Frames streamed from the phone app for the "Live" style.
+StyleCatalogue styleCatalogue;             // The styles and patterns, as sent to the phone app.
 std::vector<LightStyle*> lightStyles;
 
+// The last scene and the manual style definitions, kept across power cycles.
+SettingsStore settingsStore;
+
 // Settings that are updated via bluetooth
 byte currentBrightness = DEFAULTBRIGHTNESS;
 byte newBrightness = DEFAULTBRIGHTNESS;
@@ -63,13 +91,18 @@ int debouncePeriodMsec = 500;      // The amount of time to wait until reading t
 // Other internal state
 int loopCounter = 0;              // Records the number of times the main loop ran since the last timing calculation.
 unsigned long lastTelemetryTimestamp = 0;  // The last time debug information was emitted.
+LoopProfiler loopProfiler;        // Keeps the run times for each part of the main loop since the last telemetry.
 byte inLowPowerMode = false;      // Indicates the system should be in "low power" mode. This should be a boolean, but there are no bool types.
+bool hasShownStyle = false;       // Indicates a style has been displayed, so there's something to fade out when it changes.
 
 // Main entry point for the program --
 // This is run once at startup.
 void setup() {
   // Delay for debugging
-  delay(INITIALDELAY);
+  if (INITIALDELAY > 0) {
+    delay(INITIALDELAY);
+  }
+
   Serial.begin(9600);
   Serial.println("Starting...");
   lastTelemetryTimestamp = millis();
@@ -77,9 +110,26 @@ void setup() {
   // Initialize components
   pixelBuffer.initialize();
   pixelBuffer.setBrightness(DEFAULTBRIGHTNESS);
+  pixelBuffer.setGammaCorrection(GAMMACORRECTION);
+  pixelBuffer.setDithering(DITHERING);
+  pixelBuffer.setFrameRate(FRAMERATE);
+  pixelBuffer.setShowGuardInterval(SHOWGUARDINTERVAL);
+  styleTransition.setDuration(TRANSITIONTIME);
+  styleTransition.initialize();
+  lowPowerLayer.setEnabled(false);
+  pixelBuffer.addLayer(&lowPowerLayer);
   initializeIO();
   initializeLightStyles();
   initializeManualStyleDefinitions();
+  restoreSettings();
+  runBenchmarks();
+
+  // Show the restored style right away. Starting BLE takes a while.
+  // displayPixels() doesn't wait, so make sure the strip can take a frame first
+  // (the benchmarks may have just sent one), or this frame would be skipped.
+  updateBrightness();
+  pixelBuffer.waitForFrame();
+  updateLEDs();
   startBLE();
 }
 
@@ -87,6 +137,7 @@ void setup() {
 // This metod is called continously.
 void loop()
 {  
+  ProfileTimer loopTimer(&loopProfiler, LoopPhaseTotal);
   emitTelemetry();
   checkForLowPowerState();
 
@@ -97,15 +148,22 @@ void loop()
   }
 
   // See if any settings have been changed via BLE and apply them if necessary.
-  readBleSettings();
+  // BLE reads can be corrupted while the LEDs are latching, so only read them in the time between frames.
+  if (!pixelBuffer.isLatching()) {
+    ProfileTimer bleTimer(&loopProfiler, LoopPhaseBle);
+    readBleSettings();
+  }
+
   if (manualOverrideEnabled) {
     // If any manual style buttons have been pressed, override the BLE-driven settings.
+    ProfileTimer buttonTimer(&loopProfiler, LoopPhaseButtons);
     readManualStyleButtons();
   }
 
   // Apply any updates that were received via BLE or manually
   updateBrightness();
   updateLEDs();
+  saveSettings();
 }
 
 // Initialize all input/output pins
@@ -129,7 +187,7 @@ void initializeLightStyles() {
   uint32_t pink =  Adafruit_NeoPixel::Color(230, 22, 161);
   uint32_t red = Adafruit_NeoPixel::Color(255, 0, 0);
   uint32_t blue = Adafruit_NeoPixel::Color(0, 0, 255);
-  uint32_t white = Adafruit_NeoPixel::Color(255, 255, 255);
+  //uint32_t white = Adafruit_NeoPixel::Color(255, 255, 255);
   uint32_t orange = Adafruit_NeoPixel::Color(255, 50, 0);
   lightStyles.push_back(new SingleColorStyle("Pink", pink, &pixelBuffer));
   lightStyles.push_back(new TwoColorStyle("Blue-Pink", blue, pink, &pixelBuffer));
@@ -137,6 +195,9 @@ void initializeLightStyles() {
   lightStyles.push_back(new TwoColorStyle("Red-Pink", red, pink, &pixelBuffer));
   lightStyles.push_back(new SingleColorStyle("Red", red, &pixelBuffer));
   lightStyles.push_back(new TwoColorStyle("Orange-Pink", orange, pink, &pixelBuffer));
+  lightStyles.push_back(new RainbowWaveStyle("Rainbow Wave", &pixelBuffer));
+  lightStyles.push_back(new TwoColorWaveStyle("Blue-Pink Wave", blue, pink, &pixelBuffer));
+  lightStyles.push_back(new LiveStyle("Live", &frameStream, &pixelBuffer));
   //lightStyles.push_back(new SingleColorStyle("White", white, &pixelBuffer));
 }
 
@@ -151,9 +212,23 @@ void initializeManualStyleDefinitions() {
   manualStyleDefinitions[3].push_back(ManualSelection(0, 255, 1, 100, 100)); // Rainbow
 }
 
+// Time the pixel buffer and light style operations and print the results.
+// The styles are reset on the first loop iteration, so this can leave them in any state.
+void runBenchmarks() {
+  if (BENCHMARKITERATIONS == 0) {
+    return;
+  }
+
+  Benchmarks benchmarks(&pixelBuffer, BENCHMARKITERATIONS);
+  benchmarks.runShiftBenchmarks();
+  benchmarks.runStyleBenchmarks(lightStyles);
+  benchmarks.runAllocationCheck(lightStyles);
+}
+
 // Set the initial BLE characteristic values and start the BLE service.
 void startBLE() {
   btService.initialize();
+  btService.setFrameStream(&frameStream);
 
   std::vector<String> styleNames;
   for (int i = 0; i < lightStyles.size(); i++) {
@@ -162,41 +237,117 @@ void startBLE() {
 
   btService.setStyleNames(styleNames);
   btService.setPatternNames(LightStyle::knownPatterns);
-  btService.setBrightness(DEFAULTBRIGHTNESS);
-  btService.setStyle(DEFAULTSTYLE);
-  btService.setSpeed(DEFAULTSPEED);
-  btService.setPattern(DEFAULTPATTERN);
-  btService.setStep(DEFAULTSTEP);
+  styleCatalogue.build(lightStyles, LightStyle::knownPatterns);
+  btService.setCatalogue(&styleCatalogue);
+  btService.setBrightness(newBrightness);
+  btService.setStyle(newStyle);
+  btService.setSpeed(newSpeed);
+  btService.setPattern(newPattern);
+  btService.setStep(newStep);
 }
 
-// Read the BLE settings to see if any have been changed.
-void readBleSettings() {
-  newBrightness = btService.getBrightness();
-
-  // Check the range on the characteristic values.
-  // If out of range, ignore the update and reset the BLE characteristic to the old value.
-  newStyle = btService.getStyle();
-  if (!isInRange(newStyle, 0, lightStyles.size()-1)) {
-    btService.setStyle(currentStyle);
-    newStyle = currentStyle;
+// Load the settings saved before the last power-down, in place of the defaults.
+// Anything out of range (say, from a build with more styles) is left at the default.
+void restoreSettings() {
+  settingsStore.setSaveDelay(SETTINGSSAVEDELAY);
+  if (!settingsStore.initialize()) {
+    Serial.println("Using the default settings.");
   }
 
-  newSpeed = btService.getSpeed();
-  if (!isInRange(newSpeed, 1, 100)) {
-    btService.setSpeed(currentSpeed);
-    newSpeed = currentSpeed;
+  SceneSettings scene;
+  if (settingsStore.getScene(&scene)) {
+    Serial.println("Restoring the saved scene.");
+    if (isInRange(scene.style, 0, lightStyles.size()-1)) {
+      newStyle = scene.style;
+    }
+    if (isInRange(scene.pattern, 0, LightStyle::knownPatterns.size()-1)) {
+      currentPattern = newPattern = scene.pattern;
+    }
+    if (isInRange(scene.speed, 1, 100)) {
+      currentSpeed = newSpeed = scene.speed;
+    }
+    if (isInRange(scene.step, 1, 100)) {
+      currentStep = newStep = scene.step;
+    }
+    newBrightness = scene.brightness;
   }
 
-  newStep = btService.getStep();
-  if (!isInRange(newStep, 1, 100)) {
-    btService.setStep(currentStep);
-    newStep = currentStep;
+  std::vector<ManualSelection> storedDefinitions[4];
+  if (settingsStore.getManualStyles(storedDefinitions, 4)) {
+    bool isValid = true;
+    for (int i = 0; i < 4; i++) {
+      for (const ManualSelection& selection : storedDefinitions[i]) {
+        isValid = isValid
+          && isInRange(selection.StyleIndex, 0, lightStyles.size()-1)
+          && isInRange(selection.PatternIndex, 0, LightStyle::knownPatterns.size()-1);
+      }
+    }
+
+    if (isValid) {
+      Serial.println("Restoring the saved manual styles.");
+      for (int i = 0; i < 4; i++) {
+        manualStyleDefinitions[i] = storedDefinitions[i];
+      }
+    }
   }
-  
-  newPattern = btService.getPattern();
-  if (!isInRange(newPattern, 0, LightStyle::knownPatterns.size()-1)) {
-    btService.setPattern(currentPattern);
-    newPattern = currentPattern;
+
+  // Saves the definitions the first time (or if the stored ones were unusable).
+  settingsStore.setManualStyles(manualStyleDefinitions, 4);
+}
+
+// Save the current scene once it's stopped changing.
+void saveSettings() {
+  SceneSettings scene;
+  scene.style = currentStyle;
+  scene.pattern = currentPattern;
+  scene.speed = currentSpeed;
+  scene.step = currentStep;
+  scene.brightness = currentBrightness;
+  settingsStore.setScene(scene);
+  settingsStore.update();
+}
+
+// Read the BLE settings to see if any have been changed.
+void readBleSettings() {
+  // Only settings that were actually written by a client show up here, in the order they were written.
+  btService.poll();
+  SettingChange change;
+  while (btService.readSetting(&change)) {
+    // Check the range on the characteristic values.
+    // If out of range, ignore the update and reset the BLE characteristic to the old value.
+    switch (change.type) {
+      case SettingBrightness:
+        newBrightness = change.value;
+        break;
+      case SettingStyle:
+        if (isInRange(change.value, 0, lightStyles.size()-1)) {
+          newStyle = change.value;
+        } else {
+          btService.setStyle(newStyle);
+        }
+        break;
+      case SettingSpeed:
+        if (isInRange(change.value, 1, 100)) {
+          newSpeed = change.value;
+        } else {
+          btService.setSpeed(newSpeed);
+        }
+        break;
+      case SettingStep:
+        if (isInRange(change.value, 1, 100)) {
+          newStep = change.value;
+        } else {
+          btService.setStep(newStep);
+        }
+        break;
+      case SettingPattern:
+        if (isInRange(change.value, 0, LightStyle::knownPatterns.size()-1)) {
+          newPattern = change.value;
+        } else {
+          btService.setPattern(newPattern);
+        }
+        break;
+    }
   }
   
   // If the style changed, clear any manual style indicators.
@@ -225,7 +376,7 @@ void readManualStyleButtons() {
     if (digitalRead(inputPins[i]) == LOW) {
       if (lastManualStyleSelected == i) {
         // Pressed the same button again - update the style index.
-        manualStyleIndex = ++manualStyleIndex % manualStyleDefinitions[i].size();
+        manualStyleIndex = (manualStyleIndex + 1) % manualStyleDefinitions[i].size();
       } else {
         // Selected a different button. Reset the style index.
         manualStyleIndex = 0;
@@ -260,11 +411,15 @@ void resetManualStyleIndicators() {
 
 void blinkLowPowerIndicator() {
   // Turn all LEDs off except for the first one, which will blink red.
-  pixelBuffer.clearBuffer();
+  // The layer covers the style's pixels, so they're still there when low power mode ends.
+  lowPowerLayer.fill(0);
+  lowPowerLayer.setEnabled(true);
+  pixelBuffer.waitForFrame();
   pixelBuffer.displayPixels();
   delay(500);
 
-  pixelBuffer.setPixel(0, Adafruit_NeoPixel::Color(255, 0, 0));
+  lowPowerLayer.setPixel(0, Adafruit_NeoPixel::Color(255, 0, 0));
+  pixelBuffer.waitForFrame();
   pixelBuffer.displayPixels();
   delay(500);
 }
@@ -313,10 +468,22 @@ void updateLEDs() {
   }
 
   if (shouldResetStyle) {
+    // Fade out what's on the sign now while the new style starts up underneath it.
+    // At power-up there's nothing to fade out, so the style shows in the first frame.
+    if (hasShownStyle) {
+      styleTransition.start();
+    }
     style->reset();
+    hasShownStyle = true;
   }
 
-  style->update();
+  {
+    ProfileTimer styleTimer(&loopProfiler, LoopPhaseStyle);
+    style->update();
+    styleTransition.update();
+  }
+
+  ProfileTimer displayTimer(&loopProfiler, LoopPhaseDisplay);
   pixelBuffer.displayPixels();
 }
 
@@ -339,7 +506,7 @@ void checkForLowPowerState()
       // Enter low power mode. Disable BLE.
       btService.stop();
       inLowPowerMode = true;
-      // Low power mode will clear the pixel buffer to save energy.
+      // Low power mode will cover the pixels with a blank layer to save energy.
       // Set current style to -1 so that if we return from low power mode
       // we'll reset back to the last selected style.
       currentStyle = -1;
@@ -359,6 +526,10 @@ void checkForLowPowerState()
       // Exit low power mode.  Re-enable BLE.
       btService.resume();
       inLowPowerMode = false;
+      // Fade in from the covered frame before the cover comes off. The style behind it
+      // is reset on the next update, and restarting the fade then keeps this frame.
+      styleTransition.start();
+      lowPowerLayer.setEnabled(false);
     }
   }
 }
@@ -397,6 +568,23 @@ void emitTelemetry()
     Serial.println(timePerIteration);
     lastTelemetryTimestamp = timestamp;
     loopCounter = 0;
+
+    // Break the loop time down by phase, on Bluetooth as well as Serial.
+    uint8_t loopProfile[LOOP_PROFILER_SUMMARYSIZE];
+    loopProfiler.printSummary();
+    loopProfiler.getSummary(loopProfile);
+    btService.emitLoopProfile(loopProfile);
+    loopProfiler.reset();
+
+    // Settings are only dropped if a client writes faster than the loop reads them.
+    Serial.print("Dropped setting changes: ");
+    Serial.println(btService.getDroppedSettingCount());
+
+    // Frames streamed for the Live style, and the ones lost to a missing packet.
+    Serial.print("Streamed frames: ");
+    Serial.print(frameStream.getFrameCount());
+    Serial.print("; dropped: ");
+    Serial.println(frameStream.getDroppedFrameCount());
     
     // Output voltage info periodically
     int rawLevel = getVoltageInputLevel();
@@ -2,9 +2,13 @@
 #include <vector>
 #include "Arduino.h"
 #include "Bluetooth.h"
+#include "SettingsQueue.h"
+
+Bluetooth* Bluetooth::s_instance = nullptr;
 
 void Bluetooth::initialize() {
   Serial.println("Starting BLE...");
+  s_instance = this;
   
   if (!BLE.begin()) {
     Serial.println("BLE initialization failed!");
@@ -20,6 +24,19 @@ void Bluetooth::initialize() {
   m_ledService.addCharacteristic(m_patternCharacteristic);
   m_ledService.addCharacteristic(m_patternNamesCharacteristic);
   m_ledService.addCharacteristic(m_batteryVoltageCharacteristic);
+  m_ledService.addCharacteristic(m_sceneCharacteristic);
+  m_ledService.addCharacteristic(m_frameStreamCharacteristic);
+  m_ledService.addCharacteristic(m_catalogueCharacteristic);
+  m_ledService.addCharacteristic(m_catalogueHashCharacteristic);
+  m_ledService.addCharacteristic(m_loopProfileCharacteristic);
+  m_brightnessCharacteristic.setEventHandler(BLEWritten, onBrightnessWritten);
+  m_styleCharacteristic.setEventHandler(BLEWritten, onStyleWritten);
+  m_speedCharacteristic.setEventHandler(BLEWritten, onSpeedWritten);
+  m_stepCharacteristic.setEventHandler(BLEWritten, onStepWritten);
+  m_patternCharacteristic.setEventHandler(BLEWritten, onPatternWritten);
+  m_sceneCharacteristic.setEventHandler(BLEWritten, onSceneWritten);
+  m_frameStreamCharacteristic.setEventHandler(BLEWritten, onFramePacketWritten);
+  m_catalogueCharacteristic.setEventHandler(BLEWritten, onCataloguePageWritten);
   BLE.addService(m_ledService);
   BLE.advertise();
 }
@@ -34,8 +51,25 @@ void Bluetooth::resume() {
   BLE.advertise();
 }
 
-void Bluetooth::setStyleNames(std::vector<String> styleNames) {
-  String allStyles = *joinStrings(styleNames);
+void Bluetooth::poll() {
+  // Any writes since the last poll are handled in here, by the event handlers below.
+  BLE.poll();
+}
+
+void Bluetooth::setFrameStream(FrameStream* frameStream) {
+  m_frameStream = frameStream;
+}
+
+bool Bluetooth::readSetting(SettingChange* change) {
+  return m_settingsQueue.pop(change);
+}
+
+unsigned long Bluetooth::getDroppedSettingCount() {
+  return m_settingsQueue.getDroppedCount();
+}
+
+void Bluetooth::setStyleNames(const std::vector<String>& styleNames) {
+  String allStyles = joinStrings(styleNames);
 
   Serial.print("All style names: ");
   Serial.println(allStyles);
@@ -45,8 +79,8 @@ void Bluetooth::setStyleNames(std::vector<String> styleNames) {
   m_styleNamesCharacteristic.setValue(allStyles);
 }
 
-void Bluetooth::setPatternNames(std::vector<String> patternNames) {
-  String allPatterns = *joinStrings(patternNames);
+void Bluetooth::setPatternNames(const std::vector<String>& patternNames) {
+  String allPatterns = joinStrings(patternNames);
 
   Serial.print("All pattern names: ");
   Serial.println(allPatterns);
@@ -56,53 +90,31 @@ void Bluetooth::setPatternNames(std::vector<String> patternNames) {
   m_patternNamesCharacteristic.setValue(allPatterns);
 }
 
-byte Bluetooth::getBrightness() {
-  m_currentBrightness = readByteFromCharacteristic(m_brightnessCharacteristic, m_currentBrightness, "brightness");
-  return m_currentBrightness;
+void Bluetooth::setCatalogue(StyleCatalogue* catalogue) {
+  m_catalogue = catalogue;
+  Serial.print("Style catalogue length: ");
+  Serial.println(catalogue->getLength());
+  publishCataloguePage(0);
+  m_catalogueHashCharacteristic.setValue(catalogue->getHash());
 }
 
 void Bluetooth::setBrightness(byte brightness) {
-  m_currentBrightness = brightness;
   m_brightnessCharacteristic.setValue(brightness);
 }
 
-byte Bluetooth::getStyle() {
-  m_currentStyle = readByteFromCharacteristic(m_styleCharacteristic, m_currentStyle, "style");
-  return m_currentStyle;
-}
-
 void Bluetooth::setStyle(byte style) {
-  m_currentStyle = style;
   m_styleCharacteristic.setValue(style);
 }
 
-byte Bluetooth::getSpeed() {
-  m_currentSpeed = readByteFromCharacteristic(m_speedCharacteristic, m_currentSpeed, "speed");
-  return m_currentSpeed;
-}
-
 void Bluetooth::setSpeed(byte speed) {
-  m_currentSpeed = speed;
   m_speedCharacteristic.setValue(speed);
 }
 
-byte Bluetooth::getPattern() {
-  m_currentPattern = readByteFromCharacteristic(m_patternCharacteristic, m_currentPattern, "pattern");
-  return m_currentPattern;
-}
-
 void Bluetooth::setPattern(byte pattern) {
-  m_currentPattern = pattern;
   m_patternCharacteristic.setValue(pattern);
 }
 
-byte Bluetooth::getStep() {
-  m_currentStep = readByteFromCharacteristic(m_stepCharacteristic, m_currentStep, "step");
-  return m_currentStep;
-}
-
 void Bluetooth::setStep(byte step) {
-  m_currentStep = step;
   m_stepCharacteristic.setValue(step);
 }
 
@@ -110,27 +122,128 @@ void Bluetooth::emitBatteryVoltage(float voltage) {
   m_batteryVoltageCharacteristic.setValue(voltage);
 }
 
-byte Bluetooth::readByteFromCharacteristic(BLEByteCharacteristic characteristic, byte defaultValue, String name) {
-  if (BLE.connected()) {
-    if (characteristic.written()) {
-      Serial.print("Reading new value for ");
-      Serial.print(name);
-      byte valByte = characteristic.value();
-      Serial.print(". Byte received: ");
-      Serial.println(valByte, HEX);
-      return valByte;
+void Bluetooth::emitLoopProfile(const uint8_t* summary) {
+  m_loopProfileCharacteristic.writeValue(summary, LOOP_PROFILER_SUMMARYSIZE);
+}
+
+void Bluetooth::onBrightnessWritten(BLEDevice central, BLECharacteristic characteristic) {
+  s_instance->queueSetting(SettingBrightness, s_instance->m_brightnessCharacteristic, "brightness");
+}
+
+void Bluetooth::onStyleWritten(BLEDevice central, BLECharacteristic characteristic) {
+  s_instance->queueSetting(SettingStyle, s_instance->m_styleCharacteristic, "style");
+}
+
+void Bluetooth::onSpeedWritten(BLEDevice central, BLECharacteristic characteristic) {
+  s_instance->queueSetting(SettingSpeed, s_instance->m_speedCharacteristic, "speed");
+}
+
+void Bluetooth::onStepWritten(BLEDevice central, BLECharacteristic characteristic) {
+  s_instance->queueSetting(SettingStep, s_instance->m_stepCharacteristic, "step");
+}
+
+void Bluetooth::onPatternWritten(BLEDevice central, BLECharacteristic characteristic) {
+  s_instance->queueSetting(SettingPattern, s_instance->m_patternCharacteristic, "pattern");
+}
+
+void Bluetooth::onSceneWritten(BLEDevice central, BLECharacteristic characteristic) {
+  s_instance->queueScene();
+}
+
+void Bluetooth::onFramePacketWritten(BLEDevice central, BLECharacteristic characteristic) {
+  // Packets come in fast, so they're decoded right away without any logging.
+  if (s_instance->m_frameStream != nullptr) {
+    s_instance->m_frameStream->receivePacket(characteristic.value(), characteristic.valueLength());
+  }
+}
+
+void Bluetooth::onCataloguePageWritten(BLEDevice central, BLECharacteristic characteristic) {
+  if (characteristic.valueLength() > 0) {
+    s_instance->publishCataloguePage(characteristic.value()[0]);
+  }
+}
+
+void Bluetooth::publishCataloguePage(uint8_t page) {
+  if (m_catalogue == nullptr) {
+    return;
+  }
+
+  uint16_t length = m_catalogue->getLength();
+  uint8_t pageCount = (length + BLUETOOTH_H_CATALOGUEPAGESIZE - 1) / BLUETOOTH_H_CATALOGUEPAGESIZE;
+  uint16_t start = page * BLUETOOTH_H_CATALOGUEPAGESIZE;
+  uint16_t pageLength = 0;
+  if (start < length) {
+    pageLength = length - start;
+    if (pageLength > BLUETOOTH_H_CATALOGUEPAGESIZE) {
+      pageLength = BLUETOOTH_H_CATALOGUEPAGESIZE;
     }
   }
 
-  return defaultValue;
+  // A page past the end comes back with just the header.
+  uint8_t value[BLUETOOTH_H_CATALOGUEPAGESIZE + 2];
+  value[0] = page;
+  value[1] = pageCount;
+  if (pageLength > 0) {
+    memcpy(value + 2, m_catalogue->getData() + start, pageLength);
+  }
+
+  m_catalogueCharacteristic.writeValue(value, pageLength + 2);
+}
+
+void Bluetooth::queueSetting(SettingType type, BLEByteCharacteristic& characteristic, const char* name) {
+  byte valByte = characteristic.value();
+  Serial.print("Reading new value for ");
+  Serial.print(name);
+  Serial.print(". Byte received: ");
+  Serial.println(valByte, HEX);
+  if (!m_settingsQueue.push(SettingChange{type, valByte})) {
+    Serial.println("Settings queue is full - dropped the new value.");
+  }
+}
+
+void Bluetooth::queueScene() {
+  if (m_sceneCharacteristic.valueLength() != BLUETOOTH_H_SCENELENGTH) {
+    Serial.println("Ignoring scene with the wrong length.");
+    return;
+  }
+
+  const uint8_t* scene = m_sceneCharacteristic.value();
+  Serial.print("Reading new scene. Bytes received: ");
+  for (int i = 0; i < BLUETOOTH_H_SCENELENGTH; i++) {
+    Serial.print(scene[i], HEX);
+    Serial.print(" ");
+  }
+
+  Serial.println();
+
+  // The whole scene goes in the queue at once, so it's applied in a single update.
+  SettingChange changes[] = {
+    { SettingStyle, scene[0] },
+    { SettingPattern, scene[1] },
+    { SettingSpeed, scene[2] },
+    { SettingStep, scene[3] },
+    { SettingBrightness, scene[4] }
+  };
+
+  if (!m_settingsQueue.push(changes, BLUETOOTH_H_SCENELENGTH)) {
+    Serial.println("Settings queue is full - dropped the new scene.");
+    return;
+  }
+
+  // Keep the individual characteristics in step for clients that read them.
+  m_styleCharacteristic.setValue(scene[0]);
+  m_patternCharacteristic.setValue(scene[1]);
+  m_speedCharacteristic.setValue(scene[2]);
+  m_stepCharacteristic.setValue(scene[3]);
+  m_brightnessCharacteristic.setValue(scene[4]);
 }
 
-String* Bluetooth::joinStrings(std::vector<String> strings) {
-  String* joinedStrings = new String();
+String Bluetooth::joinStrings(const std::vector<String>& strings) {
+  String joinedStrings;
   for (int i = 0; i < strings.size(); i++) {
-    joinedStrings->concat(strings.at(i));
+    joinedStrings.concat(strings.at(i));
     if (i < strings.size()-1) {
-      joinedStrings->concat(";");
+      joinedStrings.concat(";");
     }
   }
 
@@ -2,33 +2,62 @@
 #include <ArduinoBLE.h>
 #include <vector>
 #include "Arduino.h"
+#include "LoopProfiler.h"
+#include "SettingsQueue.h"
+#include "FrameStream.h"
+#include "StyleCatalogue.h"
 
 #ifndef BLUETOOTH_H
 #define BLUETOOTH_H
 
 # define BLUETOOTH_H_MAXSTRINGLENGTH 250
 
+// The scene characteristic sets several settings in one write.
+// The bytes are: style, pattern, speed, step, brightness.
+# define BLUETOOTH_H_SCENELENGTH 5
+
+// The catalogue is read a page at a time. Each page is the page number,
+// the number of pages, then up to this many bytes of the catalogue.
+# define BLUETOOTH_H_CATALOGUEPAGESIZE 240
+
 class Bluetooth {
   public:
     void initialize();
     void stop();
     void resume();
 
-    void setStyleNames(std::vector<String> styleNames);
-    void setPatternNames(std::vector<String> patternNames);
+    // Handles any pending BLE events. Settings written by a client are queued
+    // until they're read with readSetting().
+    void poll();
+
+    // Sets where frames streamed by a client are sent.
+    void setFrameStream(FrameStream* frameStream);
+
+    // Takes the oldest setting written by a client off the queue.
+    // Returns false if there are no more.
+    bool readSetting(SettingChange* change);
+
+    // Gets the number of setting changes dropped because the queue was full.
+    unsigned long getDroppedSettingCount();
+
+    void setStyleNames(const std::vector<String>& styleNames);
+    void setPatternNames(const std::vector<String>& patternNames);
+
+    // Publishes the style catalogue. Clients pick a page by writing its number
+    // to the catalogue characteristic, then read it back. The catalogue's hash is
+    // published on its own characteristic, so clients can tell when to read it again.
+    void setCatalogue(StyleCatalogue* catalogue);
     void setBrightness(byte brightness);
-    byte getBrightness();
     void setStyle(byte style);
-    byte getStyle();
     void setPattern(byte pattern);
-    byte getPattern();
     void setStep(byte step);
-    byte getStep();
     void setSpeed(byte speed);
-    byte getSpeed();
 
     void emitBatteryVoltage(float voltage);
 
+    // Publishes the loop timing summary from LoopProfiler::getSummary.
+    void emitLoopProfile(const uint8_t* summary);
+
   private:
     BLEService m_ledService{ "99be4fac-c708-41e5-a149-74047f554cc1" };
     BLEByteCharacteristic m_brightnessCharacteristic{ "5eccb54e-465f-47f4-ac50-6735bfc0e730", BLERead | BLENotify | BLEWrite };
@@ -39,15 +68,31 @@ class Bluetooth {
     BLEByteCharacteristic m_patternCharacteristic{ "6b503d25-f643-4823-a8a6-da51109e713f", BLERead | BLENotify | BLEWrite };
     BLEStringCharacteristic m_patternNamesCharacteristic{ "348195d1-e237-4b0b-aea4-c818c3eb5e2a", BLERead, BLUETOOTH_H_MAXSTRINGLENGTH };
     BLEFloatCharacteristic m_batteryVoltageCharacteristic{ "ea0a95bc-7561-4b1e-8925-7973b3ad7b9a", BLERead | BLENotify };
+    BLECharacteristic m_sceneCharacteristic{ "6dbc7e1f-bafe-4d34-8ea3-cfc544da9b61", BLEWrite, BLUETOOTH_H_SCENELENGTH, true };
+    BLECharacteristic m_frameStreamCharacteristic{ "5480a7cd-a5bb-4685-aa3d-aeaa4212e2b3", BLEWriteWithoutResponse, FRAME_STREAM_MAXPACKETSIZE };
+    BLECharacteristic m_catalogueCharacteristic{ "97467b1a-4953-492c-8c8a-ffa9efd47b2c", BLERead | BLEWrite, BLUETOOTH_H_CATALOGUEPAGESIZE + 2 };
+    BLEUnsignedIntCharacteristic m_catalogueHashCharacteristic{ "5c33c9eb-2026-4a32-8e5e-9ae8de67699c", BLERead | BLENotify };
+    BLECharacteristic m_loopProfileCharacteristic{ "0c0ef4a3-a898-4ce2-8fea-6733bfed6ecd", BLERead | BLENotify, LOOP_PROFILER_SUMMARYSIZE, true };
+
+    SettingsQueue m_settingsQueue;
+    FrameStream* m_frameStream{nullptr};
+    StyleCatalogue* m_catalogue{nullptr};
 
-    byte m_currentBrightness{0};
-    byte m_currentStyle{0};
-    byte m_currentPattern{0};
-    byte m_currentSpeed{0};
-    byte m_currentStep{0};
+    // The event handlers are plain functions, so they find the service through this.
+    static Bluetooth* s_instance;
+    static void onBrightnessWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onStyleWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onSpeedWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onStepWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onPatternWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onSceneWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onFramePacketWritten(BLEDevice central, BLECharacteristic characteristic);
+    static void onCataloguePageWritten(BLEDevice central, BLECharacteristic characteristic);
 
-    String* joinStrings(std::vector<String> strings);
-    byte readByteFromCharacteristic(BLEByteCharacteristic characteristic, byte defaultValue, String name);
+    String joinStrings(const std::vector<String>& strings);
+    void publishCataloguePage(uint8_t page);
+    void queueSetting(SettingType type, BLEByteCharacteristic& characteristic, const char* name);
+    void queueScene();
 };
 
 #endif
\ No newline at end of file
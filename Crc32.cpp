@@ -0,0 +1,14 @@
+#include "Arduino.h"
+#include "Crc32.h"
+
+uint32_t Crc32::compute(const uint8_t* data, uint32_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (uint32_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+
+  return ~crc;
+}
@@ -0,0 +1,13 @@
+#include "Arduino.h"
+
+#ifndef CRC32_H
+#define CRC32_H
+
+// The standard (zlib) CRC-32, computed a bit at a time. It's only used on small
+// blocks that are rarely checked, so there's no table taking up flash.
+class Crc32 {
+  public:
+    static uint32_t compute(const uint8_t* data, uint32_t length);
+};
+
+#endif
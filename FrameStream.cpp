@@ -0,0 +1,160 @@
+#include "Arduino.h"
+#include "FrameStream.h"
+#include "PixelBuffer.h"
+
+FrameStream::FrameStream() {
+  memset(m_frontColors, 0, sizeof(m_frontColors));
+  memset(m_backColors, 0, sizeof(m_backColors));
+  memset(m_palette, 0, sizeof(m_palette));
+}
+
+void FrameStream::receivePacket(const uint8_t* packet, int length) {
+  if (length < FRAME_STREAM_HEADERSIZE) {
+    return;
+  }
+
+  uint8_t frameNumber = packet[0];
+  uint8_t packetNumber = packet[1];
+  uint8_t flags = packet[2];
+  uint8_t encoding = packet[3];
+  uint16_t start = packet[4] | (packet[5] << 8);
+
+  if (flags & FRAME_STREAM_FIRSTPACKET) {
+    if (m_isAssembling) {
+      // The last frame never finished.
+      dropFrame();
+    }
+
+    // Start from the last complete frame, so only the changes need to be sent.
+    memcpy(m_backColors, m_frontColors, sizeof(m_backColors));
+    m_isAssembling = true;
+    m_frameNumber = frameNumber;
+    m_nextPacket = 0;
+  }
+
+  if (!m_isAssembling) {
+    // Waiting for the start of the next frame.
+    return;
+  }
+
+  if (frameNumber != m_frameNumber || packetNumber != m_nextPacket) {
+    // A packet went missing (or arrived out of order).
+    dropFrame();
+    return;
+  }
+
+  if (!decodePacket(encoding, start, packet + FRAME_STREAM_HEADERSIZE, length - FRAME_STREAM_HEADERSIZE)) {
+    dropFrame();
+    return;
+  }
+
+  m_nextPacket++;
+  if (flags & FRAME_STREAM_LASTPACKET) {
+    memcpy(m_frontColors, m_backColors, sizeof(m_frontColors));
+    m_isAssembling = false;
+    m_hasNewFrame = true;
+    m_frameCount++;
+  }
+}
+
+bool FrameStream::hasNewFrame() {
+  return m_hasNewFrame;
+}
+
+void FrameStream::copyFrame(PixelBuffer* pixelBuffer) {
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    pixelBuffer->setPixel(i, m_frontColors[i]);
+  }
+
+  m_hasNewFrame = false;
+}
+
+unsigned long FrameStream::getFrameCount() {
+  return m_frameCount;
+}
+
+unsigned long FrameStream::getDroppedFrameCount() {
+  return m_droppedFrameCount;
+}
+
+bool FrameStream::decodePacket(uint8_t encoding, uint16_t start, const uint8_t* data, int length) {
+  // Returns false if the packet is malformed or runs off the end of the frame (or palette).
+  uint16_t pixel = start;
+  switch (encoding) {
+    case FrameEncodingRaw:
+      if (length % 3 != 0 || start + length / 3 > ActiveLayout::PixelCount) {
+        return false;
+      }
+
+      for (int i = 0; i < length; i += 3) {
+        m_backColors[pixel++] = Adafruit_NeoPixel::Color(data[i], data[i + 1], data[i + 2]);
+      }
+
+      return true;
+
+    case FrameEncodingPalette:
+      if (length % 3 != 0 || start + length / 3 > 256) {
+        return false;
+      }
+
+      for (int i = 0; i < length; i += 3) {
+        m_palette[pixel++] = Adafruit_NeoPixel::Color(data[i], data[i + 1], data[i + 2]);
+      }
+
+      return true;
+
+    case FrameEncodingIndexed8:
+      if (start + length > ActiveLayout::PixelCount) {
+        return false;
+      }
+
+      for (int i = 0; i < length; i++) {
+        m_backColors[pixel++] = m_palette[data[i]];
+      }
+
+      return true;
+
+    case FrameEncodingIndexed4: {
+      // An odd pixel count leaves the last high nibble unused, so allow for one spare.
+      if (start + length * 2 > ActiveLayout::PixelCount + 1) {
+        return false;
+      }
+
+      for (int i = 0; i < length; i++) {
+        m_backColors[pixel++] = m_palette[data[i] & 0x0F];
+        if (pixel < ActiveLayout::PixelCount) {
+          m_backColors[pixel++] = m_palette[data[i] >> 4];
+        }
+      }
+
+      return true;
+    }
+
+    case FrameEncodingRuns:
+      if (length % 2 != 0) {
+        return false;
+      }
+
+      for (int i = 0; i < length; i += 2) {
+        uint8_t count = data[i];
+        uint32_t color = m_palette[data[i + 1]];
+        if (pixel + count > ActiveLayout::PixelCount) {
+          return false;
+        }
+
+        for (int j = 0; j < count; j++) {
+          m_backColors[pixel++] = color;
+        }
+      }
+
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+void FrameStream::dropFrame() {
+  m_isAssembling = false;
+  m_droppedFrameCount++;
+}
@@ -0,0 +1,69 @@
+#include "Arduino.h"
+#include "PixelBuffer.h"
+
+#ifndef FRAME_STREAM_H
+#define FRAME_STREAM_H
+
+// The largest packet accepted, which is the largest BLE write that fits in a 247-byte MTU.
+#define FRAME_STREAM_MAXPACKETSIZE 244
+
+// Frames streamed to the sign, a few packets at a time.
+//
+// Each packet starts with a 6-byte header:
+//   byte 0: frame number. Every packet in a frame has the same number.
+//   byte 1: packet number within the frame, starting at 0.
+//   byte 2: flags (FRAME_STREAM_FIRSTPACKET, FRAME_STREAM_LASTPACKET).
+//   byte 3: encoding (FrameEncoding).
+//   bytes 4-5: the first pixel the packet covers (little-endian).
+// followed by the encoded data.
+//
+// A new frame starts as a copy of the last complete frame, so a packet only has to
+// cover the pixels that changed. The frame is only shown once its last packet arrives
+// with none missing; if a packet is lost, the rest of the frame is ignored.
+#define FRAME_STREAM_HEADERSIZE 6
+#define FRAME_STREAM_FIRSTPACKET 0x01
+#define FRAME_STREAM_LASTPACKET 0x02
+
+enum FrameEncoding : uint8_t {
+  FrameEncodingRaw,       // R, G, B for each pixel.
+  FrameEncodingPalette,   // R, G, B for each palette entry, starting at the "first pixel" entry. Sets no pixels.
+  FrameEncodingIndexed8,  // A palette index for each pixel.
+  FrameEncodingIndexed4,  // A palette index (0-15) for each pixel, two per byte, low nibble first.
+  FrameEncodingRuns       // Pairs of (count, palette index): count pixels of the same color.
+};
+
+class FrameStream {
+  public:
+    FrameStream();
+
+    // Decodes a packet into the frame being assembled.
+    void receivePacket(const uint8_t* packet, int length);
+
+    // Indicates a complete frame has arrived since the last call to copyFrame().
+    bool hasNewFrame();
+
+    // Copies the last complete frame into the pixel buffer.
+    void copyFrame(PixelBuffer* pixelBuffer);
+
+    // Counters for diagnostics.
+    unsigned long getFrameCount();
+    unsigned long getDroppedFrameCount();
+
+  private:
+    // The last complete frame, and the frame being assembled.
+    uint32_t m_frontColors[ActiveLayout::PixelCount];
+    uint32_t m_backColors[ActiveLayout::PixelCount];
+    uint32_t m_palette[256];
+
+    bool m_isAssembling{false};
+    uint8_t m_frameNumber{0};
+    uint8_t m_nextPacket{0};
+    bool m_hasNewFrame{false};
+    unsigned long m_frameCount{0};
+    unsigned long m_droppedFrameCount{0};
+
+    bool decodePacket(uint8_t encoding, uint16_t start, const uint8_t* data, int length);
+    void dropFrame();
+};
+
+#endif
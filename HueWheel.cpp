@@ -0,0 +1,331 @@
+#include "Arduino.h"
+#include "HueWheel.h"
+
+// The colors around the hue wheel, one entry for each of Adafruit_NeoPixel::ColorHSV's
+// 1530 distinct hues (6 segments of 255 steps) at full saturation and value.
+// Hue 1530 wraps back around to red, so it isn't stored.
+// Generated to match ColorHSV exactly; the gamma-corrected entries use the same
+// curve as Adafruit_NeoPixel::gamma8.
+#ifdef HUE_WHEEL_GAMMA
+static const uint32_t s_hueWheel[HUE_WHEEL_SIZE] = {
+  0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,
+  0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,
+  0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0100,0xFF0100,0xFF0100,0xFF0100,0xFF0100,0xFF0100,
+  0xFF0100,0xFF0100,0xFF0100,0xFF0100,0xFF0100,0xFF0100,0xFF0200,0xFF0200,0xFF0200,0xFF0200,
+  0xFF0200,0xFF0200,0xFF0200,0xFF0200,0xFF0300,0xFF0300,0xFF0300,0xFF0300,0xFF0300,0xFF0300,
+  0xFF0400,0xFF0400,0xFF0400,0xFF0400,0xFF0500,0xFF0500,0xFF0500,0xFF0500,0xFF0500,0xFF0600,
+  0xFF0600,0xFF0600,0xFF0600,0xFF0700,0xFF0700,0xFF0700,0xFF0800,0xFF0800,0xFF0800,0xFF0900,
+  0xFF0900,0xFF0900,0xFF0A00,0xFF0A00,0xFF0A00,0xFF0B00,0xFF0B00,0xFF0B00,0xFF0C00,0xFF0C00,
+  0xFF0D00,0xFF0D00,0xFF0D00,0xFF0E00,0xFF0E00,0xFF0F00,0xFF0F00,0xFF1000,0xFF1000,0xFF1100,
+  0xFF1100,0xFF1200,0xFF1200,0xFF1300,0xFF1300,0xFF1400,0xFF1400,0xFF1500,0xFF1500,0xFF1600,
+  0xFF1600,0xFF1700,0xFF1800,0xFF1800,0xFF1900,0xFF1900,0xFF1A00,0xFF1B00,0xFF1B00,0xFF1C00,
+  0xFF1D00,0xFF1D00,0xFF1E00,0xFF1F00,0xFF1F00,0xFF2000,0xFF2100,0xFF2200,0xFF2200,0xFF2300,
+  0xFF2400,0xFF2500,0xFF2600,0xFF2600,0xFF2700,0xFF2800,0xFF2900,0xFF2A00,0xFF2A00,0xFF2B00,
+  0xFF2C00,0xFF2D00,0xFF2E00,0xFF2F00,0xFF3000,0xFF3100,0xFF3200,0xFF3300,0xFF3400,0xFF3500,
+  0xFF3600,0xFF3700,0xFF3800,0xFF3900,0xFF3A00,0xFF3B00,0xFF3C00,0xFF3D00,0xFF3E00,0xFF3F00,
+  0xFF4000,0xFF4100,0xFF4200,0xFF4400,0xFF4500,0xFF4600,0xFF4700,0xFF4800,0xFF4900,0xFF4B00,
+  0xFF4C00,0xFF4D00,0xFF4E00,0xFF5000,0xFF5100,0xFF5200,0xFF5400,0xFF5500,0xFF5600,0xFF5800,
+  0xFF5900,0xFF5A00,0xFF5C00,0xFF5D00,0xFF5E00,0xFF6000,0xFF6100,0xFF6300,0xFF6400,0xFF6600,
+  0xFF6700,0xFF6900,0xFF6A00,0xFF6C00,0xFF6D00,0xFF6F00,0xFF7000,0xFF7200,0xFF7300,0xFF7500,
+  0xFF7700,0xFF7800,0xFF7A00,0xFF7C00,0xFF7D00,0xFF7F00,0xFF8100,0xFF8200,0xFF8400,0xFF8600,
+  0xFF8800,0xFF8900,0xFF8B00,0xFF8D00,0xFF8F00,0xFF9100,0xFF9200,0xFF9400,0xFF9600,0xFF9800,
+  0xFF9A00,0xFF9C00,0xFF9E00,0xFFA000,0xFFA200,0xFFA400,0xFFA600,0xFFA800,0xFFAA00,0xFFAC00,
+  0xFFAE00,0xFFB000,0xFFB200,0xFFB400,0xFFB600,0xFFB800,0xFFBA00,0xFFBC00,0xFFBF00,0xFFC100,
+  0xFFC300,0xFFC500,0xFFC700,0xFFCA00,0xFFCC00,0xFFCE00,0xFFD100,0xFFD300,0xFFD500,0xFFD700,
+  0xFFDA00,0xFFDC00,0xFFDF00,0xFFE100,0xFFE300,0xFFE600,0xFFE800,0xFFEB00,0xFFED00,0xFFF000,
+  0xFFF200,0xFFF500,0xFFF700,0xFFFA00,0xFFFC00,0xFFFF00,0xFCFF00,0xFAFF00,0xF7FF00,0xF5FF00,
+  0xF2FF00,0xF0FF00,0xEDFF00,0xEBFF00,0xE8FF00,0xE6FF00,0xE3FF00,0xE1FF00,0xDFFF00,0xDCFF00,
+  0xDAFF00,0xD7FF00,0xD5FF00,0xD3FF00,0xD1FF00,0xCEFF00,0xCCFF00,0xCAFF00,0xC7FF00,0xC5FF00,
+  0xC3FF00,0xC1FF00,0xBFFF00,0xBCFF00,0xBAFF00,0xB8FF00,0xB6FF00,0xB4FF00,0xB2FF00,0xB0FF00,
+  0xAEFF00,0xACFF00,0xAAFF00,0xA8FF00,0xA6FF00,0xA4FF00,0xA2FF00,0xA0FF00,0x9EFF00,0x9CFF00,
+  0x9AFF00,0x98FF00,0x96FF00,0x94FF00,0x92FF00,0x91FF00,0x8FFF00,0x8DFF00,0x8BFF00,0x89FF00,
+  0x88FF00,0x86FF00,0x84FF00,0x82FF00,0x81FF00,0x7FFF00,0x7DFF00,0x7CFF00,0x7AFF00,0x78FF00,
+  0x77FF00,0x75FF00,0x73FF00,0x72FF00,0x70FF00,0x6FFF00,0x6DFF00,0x6CFF00,0x6AFF00,0x69FF00,
+  0x67FF00,0x66FF00,0x64FF00,0x63FF00,0x61FF00,0x60FF00,0x5EFF00,0x5DFF00,0x5CFF00,0x5AFF00,
+  0x59FF00,0x58FF00,0x56FF00,0x55FF00,0x54FF00,0x52FF00,0x51FF00,0x50FF00,0x4EFF00,0x4DFF00,
+  0x4CFF00,0x4BFF00,0x49FF00,0x48FF00,0x47FF00,0x46FF00,0x45FF00,0x44FF00,0x42FF00,0x41FF00,
+  0x40FF00,0x3FFF00,0x3EFF00,0x3DFF00,0x3CFF00,0x3BFF00,0x3AFF00,0x39FF00,0x38FF00,0x37FF00,
+  0x36FF00,0x35FF00,0x34FF00,0x33FF00,0x32FF00,0x31FF00,0x30FF00,0x2FFF00,0x2EFF00,0x2DFF00,
+  0x2CFF00,0x2BFF00,0x2AFF00,0x2AFF00,0x29FF00,0x28FF00,0x27FF00,0x26FF00,0x26FF00,0x25FF00,
+  0x24FF00,0x23FF00,0x22FF00,0x22FF00,0x21FF00,0x20FF00,0x1FFF00,0x1FFF00,0x1EFF00,0x1DFF00,
+  0x1DFF00,0x1CFF00,0x1BFF00,0x1BFF00,0x1AFF00,0x19FF00,0x19FF00,0x18FF00,0x18FF00,0x17FF00,
+  0x16FF00,0x16FF00,0x15FF00,0x15FF00,0x14FF00,0x14FF00,0x13FF00,0x13FF00,0x12FF00,0x12FF00,
+  0x11FF00,0x11FF00,0x10FF00,0x10FF00,0x0FFF00,0x0FFF00,0x0EFF00,0x0EFF00,0x0DFF00,0x0DFF00,
+  0x0DFF00,0x0CFF00,0x0CFF00,0x0BFF00,0x0BFF00,0x0BFF00,0x0AFF00,0x0AFF00,0x0AFF00,0x09FF00,
+  0x09FF00,0x09FF00,0x08FF00,0x08FF00,0x08FF00,0x07FF00,0x07FF00,0x07FF00,0x06FF00,0x06FF00,
+  0x06FF00,0x06FF00,0x05FF00,0x05FF00,0x05FF00,0x05FF00,0x05FF00,0x04FF00,0x04FF00,0x04FF00,
+  0x04FF00,0x03FF00,0x03FF00,0x03FF00,0x03FF00,0x03FF00,0x03FF00,0x02FF00,0x02FF00,0x02FF00,
+  0x02FF00,0x02FF00,0x02FF00,0x02FF00,0x02FF00,0x01FF00,0x01FF00,0x01FF00,0x01FF00,0x01FF00,
+  0x01FF00,0x01FF00,0x01FF00,0x01FF00,0x01FF00,0x01FF00,0x01FF00,0x00FF00,0x00FF00,0x00FF00,
+  0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,
+  0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,
+  0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,
+  0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF00,
+  0x00FF00,0x00FF00,0x00FF00,0x00FF00,0x00FF01,0x00FF01,0x00FF01,0x00FF01,0x00FF01,0x00FF01,
+  0x00FF01,0x00FF01,0x00FF01,0x00FF01,0x00FF01,0x00FF01,0x00FF02,0x00FF02,0x00FF02,0x00FF02,
+  0x00FF02,0x00FF02,0x00FF02,0x00FF02,0x00FF03,0x00FF03,0x00FF03,0x00FF03,0x00FF03,0x00FF03,
+  0x00FF04,0x00FF04,0x00FF04,0x00FF04,0x00FF05,0x00FF05,0x00FF05,0x00FF05,0x00FF05,0x00FF06,
+  0x00FF06,0x00FF06,0x00FF06,0x00FF07,0x00FF07,0x00FF07,0x00FF08,0x00FF08,0x00FF08,0x00FF09,
+  0x00FF09,0x00FF09,0x00FF0A,0x00FF0A,0x00FF0A,0x00FF0B,0x00FF0B,0x00FF0B,0x00FF0C,0x00FF0C,
+  0x00FF0D,0x00FF0D,0x00FF0D,0x00FF0E,0x00FF0E,0x00FF0F,0x00FF0F,0x00FF10,0x00FF10,0x00FF11,
+  0x00FF11,0x00FF12,0x00FF12,0x00FF13,0x00FF13,0x00FF14,0x00FF14,0x00FF15,0x00FF15,0x00FF16,
+  0x00FF16,0x00FF17,0x00FF18,0x00FF18,0x00FF19,0x00FF19,0x00FF1A,0x00FF1B,0x00FF1B,0x00FF1C,
+  0x00FF1D,0x00FF1D,0x00FF1E,0x00FF1F,0x00FF1F,0x00FF20,0x00FF21,0x00FF22,0x00FF22,0x00FF23,
+  0x00FF24,0x00FF25,0x00FF26,0x00FF26,0x00FF27,0x00FF28,0x00FF29,0x00FF2A,0x00FF2A,0x00FF2B,
+  0x00FF2C,0x00FF2D,0x00FF2E,0x00FF2F,0x00FF30,0x00FF31,0x00FF32,0x00FF33,0x00FF34,0x00FF35,
+  0x00FF36,0x00FF37,0x00FF38,0x00FF39,0x00FF3A,0x00FF3B,0x00FF3C,0x00FF3D,0x00FF3E,0x00FF3F,
+  0x00FF40,0x00FF41,0x00FF42,0x00FF44,0x00FF45,0x00FF46,0x00FF47,0x00FF48,0x00FF49,0x00FF4B,
+  0x00FF4C,0x00FF4D,0x00FF4E,0x00FF50,0x00FF51,0x00FF52,0x00FF54,0x00FF55,0x00FF56,0x00FF58,
+  0x00FF59,0x00FF5A,0x00FF5C,0x00FF5D,0x00FF5E,0x00FF60,0x00FF61,0x00FF63,0x00FF64,0x00FF66,
+  0x00FF67,0x00FF69,0x00FF6A,0x00FF6C,0x00FF6D,0x00FF6F,0x00FF70,0x00FF72,0x00FF73,0x00FF75,
+  0x00FF77,0x00FF78,0x00FF7A,0x00FF7C,0x00FF7D,0x00FF7F,0x00FF81,0x00FF82,0x00FF84,0x00FF86,
+  0x00FF88,0x00FF89,0x00FF8B,0x00FF8D,0x00FF8F,0x00FF91,0x00FF92,0x00FF94,0x00FF96,0x00FF98,
+  0x00FF9A,0x00FF9C,0x00FF9E,0x00FFA0,0x00FFA2,0x00FFA4,0x00FFA6,0x00FFA8,0x00FFAA,0x00FFAC,
+  0x00FFAE,0x00FFB0,0x00FFB2,0x00FFB4,0x00FFB6,0x00FFB8,0x00FFBA,0x00FFBC,0x00FFBF,0x00FFC1,
+  0x00FFC3,0x00FFC5,0x00FFC7,0x00FFCA,0x00FFCC,0x00FFCE,0x00FFD1,0x00FFD3,0x00FFD5,0x00FFD7,
+  0x00FFDA,0x00FFDC,0x00FFDF,0x00FFE1,0x00FFE3,0x00FFE6,0x00FFE8,0x00FFEB,0x00FFED,0x00FFF0,
+  0x00FFF2,0x00FFF5,0x00FFF7,0x00FFFA,0x00FFFC,0x00FFFF,0x00FCFF,0x00FAFF,0x00F7FF,0x00F5FF,
+  0x00F2FF,0x00F0FF,0x00EDFF,0x00EBFF,0x00E8FF,0x00E6FF,0x00E3FF,0x00E1FF,0x00DFFF,0x00DCFF,
+  0x00DAFF,0x00D7FF,0x00D5FF,0x00D3FF,0x00D1FF,0x00CEFF,0x00CCFF,0x00CAFF,0x00C7FF,0x00C5FF,
+  0x00C3FF,0x00C1FF,0x00BFFF,0x00BCFF,0x00BAFF,0x00B8FF,0x00B6FF,0x00B4FF,0x00B2FF,0x00B0FF,
+  0x00AEFF,0x00ACFF,0x00AAFF,0x00A8FF,0x00A6FF,0x00A4FF,0x00A2FF,0x00A0FF,0x009EFF,0x009CFF,
+  0x009AFF,0x0098FF,0x0096FF,0x0094FF,0x0092FF,0x0091FF,0x008FFF,0x008DFF,0x008BFF,0x0089FF,
+  0x0088FF,0x0086FF,0x0084FF,0x0082FF,0x0081FF,0x007FFF,0x007DFF,0x007CFF,0x007AFF,0x0078FF,
+  0x0077FF,0x0075FF,0x0073FF,0x0072FF,0x0070FF,0x006FFF,0x006DFF,0x006CFF,0x006AFF,0x0069FF,
+  0x0067FF,0x0066FF,0x0064FF,0x0063FF,0x0061FF,0x0060FF,0x005EFF,0x005DFF,0x005CFF,0x005AFF,
+  0x0059FF,0x0058FF,0x0056FF,0x0055FF,0x0054FF,0x0052FF,0x0051FF,0x0050FF,0x004EFF,0x004DFF,
+  0x004CFF,0x004BFF,0x0049FF,0x0048FF,0x0047FF,0x0046FF,0x0045FF,0x0044FF,0x0042FF,0x0041FF,
+  0x0040FF,0x003FFF,0x003EFF,0x003DFF,0x003CFF,0x003BFF,0x003AFF,0x0039FF,0x0038FF,0x0037FF,
+  0x0036FF,0x0035FF,0x0034FF,0x0033FF,0x0032FF,0x0031FF,0x0030FF,0x002FFF,0x002EFF,0x002DFF,
+  0x002CFF,0x002BFF,0x002AFF,0x002AFF,0x0029FF,0x0028FF,0x0027FF,0x0026FF,0x0026FF,0x0025FF,
+  0x0024FF,0x0023FF,0x0022FF,0x0022FF,0x0021FF,0x0020FF,0x001FFF,0x001FFF,0x001EFF,0x001DFF,
+  0x001DFF,0x001CFF,0x001BFF,0x001BFF,0x001AFF,0x0019FF,0x0019FF,0x0018FF,0x0018FF,0x0017FF,
+  0x0016FF,0x0016FF,0x0015FF,0x0015FF,0x0014FF,0x0014FF,0x0013FF,0x0013FF,0x0012FF,0x0012FF,
+  0x0011FF,0x0011FF,0x0010FF,0x0010FF,0x000FFF,0x000FFF,0x000EFF,0x000EFF,0x000DFF,0x000DFF,
+  0x000DFF,0x000CFF,0x000CFF,0x000BFF,0x000BFF,0x000BFF,0x000AFF,0x000AFF,0x000AFF,0x0009FF,
+  0x0009FF,0x0009FF,0x0008FF,0x0008FF,0x0008FF,0x0007FF,0x0007FF,0x0007FF,0x0006FF,0x0006FF,
+  0x0006FF,0x0006FF,0x0005FF,0x0005FF,0x0005FF,0x0005FF,0x0005FF,0x0004FF,0x0004FF,0x0004FF,
+  0x0004FF,0x0003FF,0x0003FF,0x0003FF,0x0003FF,0x0003FF,0x0003FF,0x0002FF,0x0002FF,0x0002FF,
+  0x0002FF,0x0002FF,0x0002FF,0x0002FF,0x0002FF,0x0001FF,0x0001FF,0x0001FF,0x0001FF,0x0001FF,
+  0x0001FF,0x0001FF,0x0001FF,0x0001FF,0x0001FF,0x0001FF,0x0001FF,0x0000FF,0x0000FF,0x0000FF,
+  0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,
+  0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,
+  0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,
+  0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0000FF,
+  0x0000FF,0x0000FF,0x0000FF,0x0000FF,0x0100FF,0x0100FF,0x0100FF,0x0100FF,0x0100FF,0x0100FF,
+  0x0100FF,0x0100FF,0x0100FF,0x0100FF,0x0100FF,0x0100FF,0x0200FF,0x0200FF,0x0200FF,0x0200FF,
+  0x0200FF,0x0200FF,0x0200FF,0x0200FF,0x0300FF,0x0300FF,0x0300FF,0x0300FF,0x0300FF,0x0300FF,
+  0x0400FF,0x0400FF,0x0400FF,0x0400FF,0x0500FF,0x0500FF,0x0500FF,0x0500FF,0x0500FF,0x0600FF,
+  0x0600FF,0x0600FF,0x0600FF,0x0700FF,0x0700FF,0x0700FF,0x0800FF,0x0800FF,0x0800FF,0x0900FF,
+  0x0900FF,0x0900FF,0x0A00FF,0x0A00FF,0x0A00FF,0x0B00FF,0x0B00FF,0x0B00FF,0x0C00FF,0x0C00FF,
+  0x0D00FF,0x0D00FF,0x0D00FF,0x0E00FF,0x0E00FF,0x0F00FF,0x0F00FF,0x1000FF,0x1000FF,0x1100FF,
+  0x1100FF,0x1200FF,0x1200FF,0x1300FF,0x1300FF,0x1400FF,0x1400FF,0x1500FF,0x1500FF,0x1600FF,
+  0x1600FF,0x1700FF,0x1800FF,0x1800FF,0x1900FF,0x1900FF,0x1A00FF,0x1B00FF,0x1B00FF,0x1C00FF,
+  0x1D00FF,0x1D00FF,0x1E00FF,0x1F00FF,0x1F00FF,0x2000FF,0x2100FF,0x2200FF,0x2200FF,0x2300FF,
+  0x2400FF,0x2500FF,0x2600FF,0x2600FF,0x2700FF,0x2800FF,0x2900FF,0x2A00FF,0x2A00FF,0x2B00FF,
+  0x2C00FF,0x2D00FF,0x2E00FF,0x2F00FF,0x3000FF,0x3100FF,0x3200FF,0x3300FF,0x3400FF,0x3500FF,
+  0x3600FF,0x3700FF,0x3800FF,0x3900FF,0x3A00FF,0x3B00FF,0x3C00FF,0x3D00FF,0x3E00FF,0x3F00FF,
+  0x4000FF,0x4100FF,0x4200FF,0x4400FF,0x4500FF,0x4600FF,0x4700FF,0x4800FF,0x4900FF,0x4B00FF,
+  0x4C00FF,0x4D00FF,0x4E00FF,0x5000FF,0x5100FF,0x5200FF,0x5400FF,0x5500FF,0x5600FF,0x5800FF,
+  0x5900FF,0x5A00FF,0x5C00FF,0x5D00FF,0x5E00FF,0x6000FF,0x6100FF,0x6300FF,0x6400FF,0x6600FF,
+  0x6700FF,0x6900FF,0x6A00FF,0x6C00FF,0x6D00FF,0x6F00FF,0x7000FF,0x7200FF,0x7300FF,0x7500FF,
+  0x7700FF,0x7800FF,0x7A00FF,0x7C00FF,0x7D00FF,0x7F00FF,0x8100FF,0x8200FF,0x8400FF,0x8600FF,
+  0x8800FF,0x8900FF,0x8B00FF,0x8D00FF,0x8F00FF,0x9100FF,0x9200FF,0x9400FF,0x9600FF,0x9800FF,
+  0x9A00FF,0x9C00FF,0x9E00FF,0xA000FF,0xA200FF,0xA400FF,0xA600FF,0xA800FF,0xAA00FF,0xAC00FF,
+  0xAE00FF,0xB000FF,0xB200FF,0xB400FF,0xB600FF,0xB800FF,0xBA00FF,0xBC00FF,0xBF00FF,0xC100FF,
+  0xC300FF,0xC500FF,0xC700FF,0xCA00FF,0xCC00FF,0xCE00FF,0xD100FF,0xD300FF,0xD500FF,0xD700FF,
+  0xDA00FF,0xDC00FF,0xDF00FF,0xE100FF,0xE300FF,0xE600FF,0xE800FF,0xEB00FF,0xED00FF,0xF000FF,
+  0xF200FF,0xF500FF,0xF700FF,0xFA00FF,0xFC00FF,0xFF00FF,0xFF00FC,0xFF00FA,0xFF00F7,0xFF00F5,
+  0xFF00F2,0xFF00F0,0xFF00ED,0xFF00EB,0xFF00E8,0xFF00E6,0xFF00E3,0xFF00E1,0xFF00DF,0xFF00DC,
+  0xFF00DA,0xFF00D7,0xFF00D5,0xFF00D3,0xFF00D1,0xFF00CE,0xFF00CC,0xFF00CA,0xFF00C7,0xFF00C5,
+  0xFF00C3,0xFF00C1,0xFF00BF,0xFF00BC,0xFF00BA,0xFF00B8,0xFF00B6,0xFF00B4,0xFF00B2,0xFF00B0,
+  0xFF00AE,0xFF00AC,0xFF00AA,0xFF00A8,0xFF00A6,0xFF00A4,0xFF00A2,0xFF00A0,0xFF009E,0xFF009C,
+  0xFF009A,0xFF0098,0xFF0096,0xFF0094,0xFF0092,0xFF0091,0xFF008F,0xFF008D,0xFF008B,0xFF0089,
+  0xFF0088,0xFF0086,0xFF0084,0xFF0082,0xFF0081,0xFF007F,0xFF007D,0xFF007C,0xFF007A,0xFF0078,
+  0xFF0077,0xFF0075,0xFF0073,0xFF0072,0xFF0070,0xFF006F,0xFF006D,0xFF006C,0xFF006A,0xFF0069,
+  0xFF0067,0xFF0066,0xFF0064,0xFF0063,0xFF0061,0xFF0060,0xFF005E,0xFF005D,0xFF005C,0xFF005A,
+  0xFF0059,0xFF0058,0xFF0056,0xFF0055,0xFF0054,0xFF0052,0xFF0051,0xFF0050,0xFF004E,0xFF004D,
+  0xFF004C,0xFF004B,0xFF0049,0xFF0048,0xFF0047,0xFF0046,0xFF0045,0xFF0044,0xFF0042,0xFF0041,
+  0xFF0040,0xFF003F,0xFF003E,0xFF003D,0xFF003C,0xFF003B,0xFF003A,0xFF0039,0xFF0038,0xFF0037,
+  0xFF0036,0xFF0035,0xFF0034,0xFF0033,0xFF0032,0xFF0031,0xFF0030,0xFF002F,0xFF002E,0xFF002D,
+  0xFF002C,0xFF002B,0xFF002A,0xFF002A,0xFF0029,0xFF0028,0xFF0027,0xFF0026,0xFF0026,0xFF0025,
+  0xFF0024,0xFF0023,0xFF0022,0xFF0022,0xFF0021,0xFF0020,0xFF001F,0xFF001F,0xFF001E,0xFF001D,
+  0xFF001D,0xFF001C,0xFF001B,0xFF001B,0xFF001A,0xFF0019,0xFF0019,0xFF0018,0xFF0018,0xFF0017,
+  0xFF0016,0xFF0016,0xFF0015,0xFF0015,0xFF0014,0xFF0014,0xFF0013,0xFF0013,0xFF0012,0xFF0012,
+  0xFF0011,0xFF0011,0xFF0010,0xFF0010,0xFF000F,0xFF000F,0xFF000E,0xFF000E,0xFF000D,0xFF000D,
+  0xFF000D,0xFF000C,0xFF000C,0xFF000B,0xFF000B,0xFF000B,0xFF000A,0xFF000A,0xFF000A,0xFF0009,
+  0xFF0009,0xFF0009,0xFF0008,0xFF0008,0xFF0008,0xFF0007,0xFF0007,0xFF0007,0xFF0006,0xFF0006,
+  0xFF0006,0xFF0006,0xFF0005,0xFF0005,0xFF0005,0xFF0005,0xFF0005,0xFF0004,0xFF0004,0xFF0004,
+  0xFF0004,0xFF0003,0xFF0003,0xFF0003,0xFF0003,0xFF0003,0xFF0003,0xFF0002,0xFF0002,0xFF0002,
+  0xFF0002,0xFF0002,0xFF0002,0xFF0002,0xFF0002,0xFF0001,0xFF0001,0xFF0001,0xFF0001,0xFF0001,
+  0xFF0001,0xFF0001,0xFF0001,0xFF0001,0xFF0001,0xFF0001,0xFF0001,0xFF0000,0xFF0000,0xFF0000,
+  0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,
+  0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000,0xFF0000
+};
+#else
+static const uint32_t s_hueWheel[HUE_WHEEL_SIZE] = {
+  0xFF0000,0xFF0100,0xFF0200,0xFF0300,0xFF0400,0xFF0500,0xFF0600,0xFF0700,0xFF0800,0xFF0900,
+  0xFF0A00,0xFF0B00,0xFF0C00,0xFF0D00,0xFF0E00,0xFF0F00,0xFF1000,0xFF1100,0xFF1200,0xFF1300,
+  0xFF1400,0xFF1500,0xFF1600,0xFF1700,0xFF1800,0xFF1900,0xFF1A00,0xFF1B00,0xFF1C00,0xFF1D00,
+  0xFF1E00,0xFF1F00,0xFF2000,0xFF2100,0xFF2200,0xFF2300,0xFF2400,0xFF2500,0xFF2600,0xFF2700,
+  0xFF2800,0xFF2900,0xFF2A00,0xFF2B00,0xFF2C00,0xFF2D00,0xFF2E00,0xFF2F00,0xFF3000,0xFF3100,
+  0xFF3200,0xFF3300,0xFF3400,0xFF3500,0xFF3600,0xFF3700,0xFF3800,0xFF3900,0xFF3A00,0xFF3B00,
+  0xFF3C00,0xFF3D00,0xFF3E00,0xFF3F00,0xFF4000,0xFF4100,0xFF4200,0xFF4300,0xFF4400,0xFF4500,
+  0xFF4600,0xFF4700,0xFF4800,0xFF4900,0xFF4A00,0xFF4B00,0xFF4C00,0xFF4D00,0xFF4E00,0xFF4F00,
+  0xFF5000,0xFF5100,0xFF5200,0xFF5300,0xFF5400,0xFF5500,0xFF5600,0xFF5700,0xFF5800,0xFF5900,
+  0xFF5A00,0xFF5B00,0xFF5C00,0xFF5D00,0xFF5E00,0xFF5F00,0xFF6000,0xFF6100,0xFF6200,0xFF6300,
+  0xFF6400,0xFF6500,0xFF6600,0xFF6700,0xFF6800,0xFF6900,0xFF6A00,0xFF6B00,0xFF6C00,0xFF6D00,
+  0xFF6E00,0xFF6F00,0xFF7000,0xFF7100,0xFF7200,0xFF7300,0xFF7400,0xFF7500,0xFF7600,0xFF7700,
+  0xFF7800,0xFF7900,0xFF7A00,0xFF7B00,0xFF7C00,0xFF7D00,0xFF7E00,0xFF7F00,0xFF8000,0xFF8100,
+  0xFF8200,0xFF8300,0xFF8400,0xFF8500,0xFF8600,0xFF8700,0xFF8800,0xFF8900,0xFF8A00,0xFF8B00,
+  0xFF8C00,0xFF8D00,0xFF8E00,0xFF8F00,0xFF9000,0xFF9100,0xFF9200,0xFF9300,0xFF9400,0xFF9500,
+  0xFF9600,0xFF9700,0xFF9800,0xFF9900,0xFF9A00,0xFF9B00,0xFF9C00,0xFF9D00,0xFF9E00,0xFF9F00,
+  0xFFA000,0xFFA100,0xFFA200,0xFFA300,0xFFA400,0xFFA500,0xFFA600,0xFFA700,0xFFA800,0xFFA900,
+  0xFFAA00,0xFFAB00,0xFFAC00,0xFFAD00,0xFFAE00,0xFFAF00,0xFFB000,0xFFB100,0xFFB200,0xFFB300,
+  0xFFB400,0xFFB500,0xFFB600,0xFFB700,0xFFB800,0xFFB900,0xFFBA00,0xFFBB00,0xFFBC00,0xFFBD00,
+  0xFFBE00,0xFFBF00,0xFFC000,0xFFC100,0xFFC200,0xFFC300,0xFFC400,0xFFC500,0xFFC600,0xFFC700,
+  0xFFC800,0xFFC900,0xFFCA00,0xFFCB00,0xFFCC00,0xFFCD00,0xFFCE00,0xFFCF00,0xFFD000,0xFFD100,
+  0xFFD200,0xFFD300,0xFFD400,0xFFD500,0xFFD600,0xFFD700,0xFFD800,0xFFD900,0xFFDA00,0xFFDB00,
+  0xFFDC00,0xFFDD00,0xFFDE00,0xFFDF00,0xFFE000,0xFFE100,0xFFE200,0xFFE300,0xFFE400,0xFFE500,
+  0xFFE600,0xFFE700,0xFFE800,0xFFE900,0xFFEA00,0xFFEB00,0xFFEC00,0xFFED00,0xFFEE00,0xFFEF00,
+  0xFFF000,0xFFF100,0xFFF200,0xFFF300,0xFFF400,0xFFF500,0xFFF600,0xFFF700,0xFFF800,0xFFF900,
+  0xFFFA00,0xFFFB00,0xFFFC00,0xFFFD00,0xFFFE00,0xFFFF00,0xFEFF00,0xFDFF00,0xFCFF00,0xFBFF00,
+  0xFAFF00,0xF9FF00,0xF8FF00,0xF7FF00,0xF6FF00,0xF5FF00,0xF4FF00,0xF3FF00,0xF2FF00,0xF1FF00,
+  0xF0FF00,0xEFFF00,0xEEFF00,0xEDFF00,0xECFF00,0xEBFF00,0xEAFF00,0xE9FF00,0xE8FF00,0xE7FF00,
+  0xE6FF00,0xE5FF00,0xE4FF00,0xE3FF00,0xE2FF00,0xE1FF00,0xE0FF00,0xDFFF00,0xDEFF00,0xDDFF00,
+  0xDCFF00,0xDBFF00,0xDAFF00,0xD9FF00,0xD8FF00,0xD7FF00,0xD6FF00,0xD5FF00,0xD4FF00,0xD3FF00,
+  0xD2FF00,0xD1FF00,0xD0FF00,0xCFFF00,0xCEFF00,0xCDFF00,0xCCFF00,0xCBFF00,0xCAFF00,0xC9FF00,
+  0xC8FF00,0xC7FF00,0xC6FF00,0xC5FF00,0xC4FF00,0xC3FF00,0xC2FF00,0xC1FF00,0xC0FF00,0xBFFF00,
+  0xBEFF00,0xBDFF00,0xBCFF00,0xBBFF00,0xBAFF00,0xB9FF00,0xB8FF00,0xB7FF00,0xB6FF00,0xB5FF00,
+  0xB4FF00,0xB3FF00,0xB2FF00,0xB1FF00,0xB0FF00,0xAFFF00,0xAEFF00,0xADFF00,0xACFF00,0xABFF00,
+  0xAAFF00,0xA9FF00,0xA8FF00,0xA7FF00,0xA6FF00,0xA5FF00,0xA4FF00,0xA3FF00,0xA2FF00,0xA1FF00,
+  0xA0FF00,0x9FFF00,0x9EFF00,0x9DFF00,0x9CFF00,0x9BFF00,0x9AFF00,0x99FF00,0x98FF00,0x97FF00,
+  0x96FF00,0x95FF00,0x94FF00,0x93FF00,0x92FF00,0x91FF00,0x90FF00,0x8FFF00,0x8EFF00,0x8DFF00,
+  0x8CFF00,0x8BFF00,0x8AFF00,0x89FF00,0x88FF00,0x87FF00,0x86FF00,0x85FF00,0x84FF00,0x83FF00,
+  0x82FF00,0x81FF00,0x80FF00,0x7FFF00,0x7EFF00,0x7DFF00,0x7CFF00,0x7BFF00,0x7AFF00,0x79FF00,
+  0x78FF00,0x77FF00,0x76FF00,0x75FF00,0x74FF00,0x73FF00,0x72FF00,0x71FF00,0x70FF00,0x6FFF00,
+  0x6EFF00,0x6DFF00,0x6CFF00,0x6BFF00,0x6AFF00,0x69FF00,0x68FF00,0x67FF00,0x66FF00,0x65FF00,
+  0x64FF00,0x63FF00,0x62FF00,0x61FF00,0x60FF00,0x5FFF00,0x5EFF00,0x5DFF00,0x5CFF00,0x5BFF00,
+  0x5AFF00,0x59FF00,0x58FF00,0x57FF00,0x56FF00,0x55FF00,0x54FF00,0x53FF00,0x52FF00,0x51FF00,
+  0x50FF00,0x4FFF00,0x4EFF00,0x4DFF00,0x4CFF00,0x4BFF00,0x4AFF00,0x49FF00,0x48FF00,0x47FF00,
+  0x46FF00,0x45FF00,0x44FF00,0x43FF00,0x42FF00,0x41FF00,0x40FF00,0x3FFF00,0x3EFF00,0x3DFF00,
+  0x3CFF00,0x3BFF00,0x3AFF00,0x39FF00,0x38FF00,0x37FF00,0x36FF00,0x35FF00,0x34FF00,0x33FF00,
+  0x32FF00,0x31FF00,0x30FF00,0x2FFF00,0x2EFF00,0x2DFF00,0x2CFF00,0x2BFF00,0x2AFF00,0x29FF00,
+  0x28FF00,0x27FF00,0x26FF00,0x25FF00,0x24FF00,0x23FF00,0x22FF00,0x21FF00,0x20FF00,0x1FFF00,
+  0x1EFF00,0x1DFF00,0x1CFF00,0x1BFF00,0x1AFF00,0x19FF00,0x18FF00,0x17FF00,0x16FF00,0x15FF00,
+  0x14FF00,0x13FF00,0x12FF00,0x11FF00,0x10FF00,0x0FFF00,0x0EFF00,0x0DFF00,0x0CFF00,0x0BFF00,
+  0x0AFF00,0x09FF00,0x08FF00,0x07FF00,0x06FF00,0x05FF00,0x04FF00,0x03FF00,0x02FF00,0x01FF00,
+  0x00FF00,0x00FF01,0x00FF02,0x00FF03,0x00FF04,0x00FF05,0x00FF06,0x00FF07,0x00FF08,0x00FF09,
+  0x00FF0A,0x00FF0B,0x00FF0C,0x00FF0D,0x00FF0E,0x00FF0F,0x00FF10,0x00FF11,0x00FF12,0x00FF13,
+  0x00FF14,0x00FF15,0x00FF16,0x00FF17,0x00FF18,0x00FF19,0x00FF1A,0x00FF1B,0x00FF1C,0x00FF1D,
+  0x00FF1E,0x00FF1F,0x00FF20,0x00FF21,0x00FF22,0x00FF23,0x00FF24,0x00FF25,0x00FF26,0x00FF27,
+  0x00FF28,0x00FF29,0x00FF2A,0x00FF2B,0x00FF2C,0x00FF2D,0x00FF2E,0x00FF2F,0x00FF30,0x00FF31,
+  0x00FF32,0x00FF33,0x00FF34,0x00FF35,0x00FF36,0x00FF37,0x00FF38,0x00FF39,0x00FF3A,0x00FF3B,
+  0x00FF3C,0x00FF3D,0x00FF3E,0x00FF3F,0x00FF40,0x00FF41,0x00FF42,0x00FF43,0x00FF44,0x00FF45,
+  0x00FF46,0x00FF47,0x00FF48,0x00FF49,0x00FF4A,0x00FF4B,0x00FF4C,0x00FF4D,0x00FF4E,0x00FF4F,
+  0x00FF50,0x00FF51,0x00FF52,0x00FF53,0x00FF54,0x00FF55,0x00FF56,0x00FF57,0x00FF58,0x00FF59,
+  0x00FF5A,0x00FF5B,0x00FF5C,0x00FF5D,0x00FF5E,0x00FF5F,0x00FF60,0x00FF61,0x00FF62,0x00FF63,
+  0x00FF64,0x00FF65,0x00FF66,0x00FF67,0x00FF68,0x00FF69,0x00FF6A,0x00FF6B,0x00FF6C,0x00FF6D,
+  0x00FF6E,0x00FF6F,0x00FF70,0x00FF71,0x00FF72,0x00FF73,0x00FF74,0x00FF75,0x00FF76,0x00FF77,
+  0x00FF78,0x00FF79,0x00FF7A,0x00FF7B,0x00FF7C,0x00FF7D,0x00FF7E,0x00FF7F,0x00FF80,0x00FF81,
+  0x00FF82,0x00FF83,0x00FF84,0x00FF85,0x00FF86,0x00FF87,0x00FF88,0x00FF89,0x00FF8A,0x00FF8B,
+  0x00FF8C,0x00FF8D,0x00FF8E,0x00FF8F,0x00FF90,0x00FF91,0x00FF92,0x00FF93,0x00FF94,0x00FF95,
+  0x00FF96,0x00FF97,0x00FF98,0x00FF99,0x00FF9A,0x00FF9B,0x00FF9C,0x00FF9D,0x00FF9E,0x00FF9F,
+  0x00FFA0,0x00FFA1,0x00FFA2,0x00FFA3,0x00FFA4,0x00FFA5,0x00FFA6,0x00FFA7,0x00FFA8,0x00FFA9,
+  0x00FFAA,0x00FFAB,0x00FFAC,0x00FFAD,0x00FFAE,0x00FFAF,0x00FFB0,0x00FFB1,0x00FFB2,0x00FFB3,
+  0x00FFB4,0x00FFB5,0x00FFB6,0x00FFB7,0x00FFB8,0x00FFB9,0x00FFBA,0x00FFBB,0x00FFBC,0x00FFBD,
+  0x00FFBE,0x00FFBF,0x00FFC0,0x00FFC1,0x00FFC2,0x00FFC3,0x00FFC4,0x00FFC5,0x00FFC6,0x00FFC7,
+  0x00FFC8,0x00FFC9,0x00FFCA,0x00FFCB,0x00FFCC,0x00FFCD,0x00FFCE,0x00FFCF,0x00FFD0,0x00FFD1,
+  0x00FFD2,0x00FFD3,0x00FFD4,0x00FFD5,0x00FFD6,0x00FFD7,0x00FFD8,0x00FFD9,0x00FFDA,0x00FFDB,
+  0x00FFDC,0x00FFDD,0x00FFDE,0x00FFDF,0x00FFE0,0x00FFE1,0x00FFE2,0x00FFE3,0x00FFE4,0x00FFE5,
+  0x00FFE6,0x00FFE7,0x00FFE8,0x00FFE9,0x00FFEA,0x00FFEB,0x00FFEC,0x00FFED,0x00FFEE,0x00FFEF,
+  0x00FFF0,0x00FFF1,0x00FFF2,0x00FFF3,0x00FFF4,0x00FFF5,0x00FFF6,0x00FFF7,0x00FFF8,0x00FFF9,
+  0x00FFFA,0x00FFFB,0x00FFFC,0x00FFFD,0x00FFFE,0x00FFFF,0x00FEFF,0x00FDFF,0x00FCFF,0x00FBFF,
+  0x00FAFF,0x00F9FF,0x00F8FF,0x00F7FF,0x00F6FF,0x00F5FF,0x00F4FF,0x00F3FF,0x00F2FF,0x00F1FF,
+  0x00F0FF,0x00EFFF,0x00EEFF,0x00EDFF,0x00ECFF,0x00EBFF,0x00EAFF,0x00E9FF,0x00E8FF,0x00E7FF,
+  0x00E6FF,0x00E5FF,0x00E4FF,0x00E3FF,0x00E2FF,0x00E1FF,0x00E0FF,0x00DFFF,0x00DEFF,0x00DDFF,
+  0x00DCFF,0x00DBFF,0x00DAFF,0x00D9FF,0x00D8FF,0x00D7FF,0x00D6FF,0x00D5FF,0x00D4FF,0x00D3FF,
+  0x00D2FF,0x00D1FF,0x00D0FF,0x00CFFF,0x00CEFF,0x00CDFF,0x00CCFF,0x00CBFF,0x00CAFF,0x00C9FF,
+  0x00C8FF,0x00C7FF,0x00C6FF,0x00C5FF,0x00C4FF,0x00C3FF,0x00C2FF,0x00C1FF,0x00C0FF,0x00BFFF,
+  0x00BEFF,0x00BDFF,0x00BCFF,0x00BBFF,0x00BAFF,0x00B9FF,0x00B8FF,0x00B7FF,0x00B6FF,0x00B5FF,
+  0x00B4FF,0x00B3FF,0x00B2FF,0x00B1FF,0x00B0FF,0x00AFFF,0x00AEFF,0x00ADFF,0x00ACFF,0x00ABFF,
+  0x00AAFF,0x00A9FF,0x00A8FF,0x00A7FF,0x00A6FF,0x00A5FF,0x00A4FF,0x00A3FF,0x00A2FF,0x00A1FF,
+  0x00A0FF,0x009FFF,0x009EFF,0x009DFF,0x009CFF,0x009BFF,0x009AFF,0x0099FF,0x0098FF,0x0097FF,
+  0x0096FF,0x0095FF,0x0094FF,0x0093FF,0x0092FF,0x0091FF,0x0090FF,0x008FFF,0x008EFF,0x008DFF,
+  0x008CFF,0x008BFF,0x008AFF,0x0089FF,0x0088FF,0x0087FF,0x0086FF,0x0085FF,0x0084FF,0x0083FF,
+  0x0082FF,0x0081FF,0x0080FF,0x007FFF,0x007EFF,0x007DFF,0x007CFF,0x007BFF,0x007AFF,0x0079FF,
+  0x0078FF,0x0077FF,0x0076FF,0x0075FF,0x0074FF,0x0073FF,0x0072FF,0x0071FF,0x0070FF,0x006FFF,
+  0x006EFF,0x006DFF,0x006CFF,0x006BFF,0x006AFF,0x0069FF,0x0068FF,0x0067FF,0x0066FF,0x0065FF,
+  0x0064FF,0x0063FF,0x0062FF,0x0061FF,0x0060FF,0x005FFF,0x005EFF,0x005DFF,0x005CFF,0x005BFF,
+  0x005AFF,0x0059FF,0x0058FF,0x0057FF,0x0056FF,0x0055FF,0x0054FF,0x0053FF,0x0052FF,0x0051FF,
+  0x0050FF,0x004FFF,0x004EFF,0x004DFF,0x004CFF,0x004BFF,0x004AFF,0x0049FF,0x0048FF,0x0047FF,
+  0x0046FF,0x0045FF,0x0044FF,0x0043FF,0x0042FF,0x0041FF,0x0040FF,0x003FFF,0x003EFF,0x003DFF,
+  0x003CFF,0x003BFF,0x003AFF,0x0039FF,0x0038FF,0x0037FF,0x0036FF,0x0035FF,0x0034FF,0x0033FF,
+  0x0032FF,0x0031FF,0x0030FF,0x002FFF,0x002EFF,0x002DFF,0x002CFF,0x002BFF,0x002AFF,0x0029FF,
+  0x0028FF,0x0027FF,0x0026FF,0x0025FF,0x0024FF,0x0023FF,0x0022FF,0x0021FF,0x0020FF,0x001FFF,
+  0x001EFF,0x001DFF,0x001CFF,0x001BFF,0x001AFF,0x0019FF,0x0018FF,0x0017FF,0x0016FF,0x0015FF,
+  0x0014FF,0x0013FF,0x0012FF,0x0011FF,0x0010FF,0x000FFF,0x000EFF,0x000DFF,0x000CFF,0x000BFF,
+  0x000AFF,0x0009FF,0x0008FF,0x0007FF,0x0006FF,0x0005FF,0x0004FF,0x0003FF,0x0002FF,0x0001FF,
+  0x0000FF,0x0100FF,0x0200FF,0x0300FF,0x0400FF,0x0500FF,0x0600FF,0x0700FF,0x0800FF,0x0900FF,
+  0x0A00FF,0x0B00FF,0x0C00FF,0x0D00FF,0x0E00FF,0x0F00FF,0x1000FF,0x1100FF,0x1200FF,0x1300FF,
+  0x1400FF,0x1500FF,0x1600FF,0x1700FF,0x1800FF,0x1900FF,0x1A00FF,0x1B00FF,0x1C00FF,0x1D00FF,
+  0x1E00FF,0x1F00FF,0x2000FF,0x2100FF,0x2200FF,0x2300FF,0x2400FF,0x2500FF,0x2600FF,0x2700FF,
+  0x2800FF,0x2900FF,0x2A00FF,0x2B00FF,0x2C00FF,0x2D00FF,0x2E00FF,0x2F00FF,0x3000FF,0x3100FF,
+  0x3200FF,0x3300FF,0x3400FF,0x3500FF,0x3600FF,0x3700FF,0x3800FF,0x3900FF,0x3A00FF,0x3B00FF,
+  0x3C00FF,0x3D00FF,0x3E00FF,0x3F00FF,0x4000FF,0x4100FF,0x4200FF,0x4300FF,0x4400FF,0x4500FF,
+  0x4600FF,0x4700FF,0x4800FF,0x4900FF,0x4A00FF,0x4B00FF,0x4C00FF,0x4D00FF,0x4E00FF,0x4F00FF,
+  0x5000FF,0x5100FF,0x5200FF,0x5300FF,0x5400FF,0x5500FF,0x5600FF,0x5700FF,0x5800FF,0x5900FF,
+  0x5A00FF,0x5B00FF,0x5C00FF,0x5D00FF,0x5E00FF,0x5F00FF,0x6000FF,0x6100FF,0x6200FF,0x6300FF,
+  0x6400FF,0x6500FF,0x6600FF,0x6700FF,0x6800FF,0x6900FF,0x6A00FF,0x6B00FF,0x6C00FF,0x6D00FF,
+  0x6E00FF,0x6F00FF,0x7000FF,0x7100FF,0x7200FF,0x7300FF,0x7400FF,0x7500FF,0x7600FF,0x7700FF,
+  0x7800FF,0x7900FF,0x7A00FF,0x7B00FF,0x7C00FF,0x7D00FF,0x7E00FF,0x7F00FF,0x8000FF,0x8100FF,
+  0x8200FF,0x8300FF,0x8400FF,0x8500FF,0x8600FF,0x8700FF,0x8800FF,0x8900FF,0x8A00FF,0x8B00FF,
+  0x8C00FF,0x8D00FF,0x8E00FF,0x8F00FF,0x9000FF,0x9100FF,0x9200FF,0x9300FF,0x9400FF,0x9500FF,
+  0x9600FF,0x9700FF,0x9800FF,0x9900FF,0x9A00FF,0x9B00FF,0x9C00FF,0x9D00FF,0x9E00FF,0x9F00FF,
+  0xA000FF,0xA100FF,0xA200FF,0xA300FF,0xA400FF,0xA500FF,0xA600FF,0xA700FF,0xA800FF,0xA900FF,
+  0xAA00FF,0xAB00FF,0xAC00FF,0xAD00FF,0xAE00FF,0xAF00FF,0xB000FF,0xB100FF,0xB200FF,0xB300FF,
+  0xB400FF,0xB500FF,0xB600FF,0xB700FF,0xB800FF,0xB900FF,0xBA00FF,0xBB00FF,0xBC00FF,0xBD00FF,
+  0xBE00FF,0xBF00FF,0xC000FF,0xC100FF,0xC200FF,0xC300FF,0xC400FF,0xC500FF,0xC600FF,0xC700FF,
+  0xC800FF,0xC900FF,0xCA00FF,0xCB00FF,0xCC00FF,0xCD00FF,0xCE00FF,0xCF00FF,0xD000FF,0xD100FF,
+  0xD200FF,0xD300FF,0xD400FF,0xD500FF,0xD600FF,0xD700FF,0xD800FF,0xD900FF,0xDA00FF,0xDB00FF,
+  0xDC00FF,0xDD00FF,0xDE00FF,0xDF00FF,0xE000FF,0xE100FF,0xE200FF,0xE300FF,0xE400FF,0xE500FF,
+  0xE600FF,0xE700FF,0xE800FF,0xE900FF,0xEA00FF,0xEB00FF,0xEC00FF,0xED00FF,0xEE00FF,0xEF00FF,
+  0xF000FF,0xF100FF,0xF200FF,0xF300FF,0xF400FF,0xF500FF,0xF600FF,0xF700FF,0xF800FF,0xF900FF,
+  0xFA00FF,0xFB00FF,0xFC00FF,0xFD00FF,0xFE00FF,0xFF00FF,0xFF00FE,0xFF00FD,0xFF00FC,0xFF00FB,
+  0xFF00FA,0xFF00F9,0xFF00F8,0xFF00F7,0xFF00F6,0xFF00F5,0xFF00F4,0xFF00F3,0xFF00F2,0xFF00F1,
+  0xFF00F0,0xFF00EF,0xFF00EE,0xFF00ED,0xFF00EC,0xFF00EB,0xFF00EA,0xFF00E9,0xFF00E8,0xFF00E7,
+  0xFF00E6,0xFF00E5,0xFF00E4,0xFF00E3,0xFF00E2,0xFF00E1,0xFF00E0,0xFF00DF,0xFF00DE,0xFF00DD,
+  0xFF00DC,0xFF00DB,0xFF00DA,0xFF00D9,0xFF00D8,0xFF00D7,0xFF00D6,0xFF00D5,0xFF00D4,0xFF00D3,
+  0xFF00D2,0xFF00D1,0xFF00D0,0xFF00CF,0xFF00CE,0xFF00CD,0xFF00CC,0xFF00CB,0xFF00CA,0xFF00C9,
+  0xFF00C8,0xFF00C7,0xFF00C6,0xFF00C5,0xFF00C4,0xFF00C3,0xFF00C2,0xFF00C1,0xFF00C0,0xFF00BF,
+  0xFF00BE,0xFF00BD,0xFF00BC,0xFF00BB,0xFF00BA,0xFF00B9,0xFF00B8,0xFF00B7,0xFF00B6,0xFF00B5,
+  0xFF00B4,0xFF00B3,0xFF00B2,0xFF00B1,0xFF00B0,0xFF00AF,0xFF00AE,0xFF00AD,0xFF00AC,0xFF00AB,
+  0xFF00AA,0xFF00A9,0xFF00A8,0xFF00A7,0xFF00A6,0xFF00A5,0xFF00A4,0xFF00A3,0xFF00A2,0xFF00A1,
+  0xFF00A0,0xFF009F,0xFF009E,0xFF009D,0xFF009C,0xFF009B,0xFF009A,0xFF0099,0xFF0098,0xFF0097,
+  0xFF0096,0xFF0095,0xFF0094,0xFF0093,0xFF0092,0xFF0091,0xFF0090,0xFF008F,0xFF008E,0xFF008D,
+  0xFF008C,0xFF008B,0xFF008A,0xFF0089,0xFF0088,0xFF0087,0xFF0086,0xFF0085,0xFF0084,0xFF0083,
+  0xFF0082,0xFF0081,0xFF0080,0xFF007F,0xFF007E,0xFF007D,0xFF007C,0xFF007B,0xFF007A,0xFF0079,
+  0xFF0078,0xFF0077,0xFF0076,0xFF0075,0xFF0074,0xFF0073,0xFF0072,0xFF0071,0xFF0070,0xFF006F,
+  0xFF006E,0xFF006D,0xFF006C,0xFF006B,0xFF006A,0xFF0069,0xFF0068,0xFF0067,0xFF0066,0xFF0065,
+  0xFF0064,0xFF0063,0xFF0062,0xFF0061,0xFF0060,0xFF005F,0xFF005E,0xFF005D,0xFF005C,0xFF005B,
+  0xFF005A,0xFF0059,0xFF0058,0xFF0057,0xFF0056,0xFF0055,0xFF0054,0xFF0053,0xFF0052,0xFF0051,
+  0xFF0050,0xFF004F,0xFF004E,0xFF004D,0xFF004C,0xFF004B,0xFF004A,0xFF0049,0xFF0048,0xFF0047,
+  0xFF0046,0xFF0045,0xFF0044,0xFF0043,0xFF0042,0xFF0041,0xFF0040,0xFF003F,0xFF003E,0xFF003D,
+  0xFF003C,0xFF003B,0xFF003A,0xFF0039,0xFF0038,0xFF0037,0xFF0036,0xFF0035,0xFF0034,0xFF0033,
+  0xFF0032,0xFF0031,0xFF0030,0xFF002F,0xFF002E,0xFF002D,0xFF002C,0xFF002B,0xFF002A,0xFF0029,
+  0xFF0028,0xFF0027,0xFF0026,0xFF0025,0xFF0024,0xFF0023,0xFF0022,0xFF0021,0xFF0020,0xFF001F,
+  0xFF001E,0xFF001D,0xFF001C,0xFF001B,0xFF001A,0xFF0019,0xFF0018,0xFF0017,0xFF0016,0xFF0015,
+  0xFF0014,0xFF0013,0xFF0012,0xFF0011,0xFF0010,0xFF000F,0xFF000E,0xFF000D,0xFF000C,0xFF000B,
+  0xFF000A,0xFF0009,0xFF0008,0xFF0007,0xFF0006,0xFF0005,0xFF0004,0xFF0003,0xFF0002,0xFF0001
+};
+#endif
+
+uint32_t HueWheel::getColor(uint16_t hue) {
+  // Same rounding as ColorHSV: scale the 16-bit hue down to 0-1530.
+  uint16_t index = ((uint32_t)hue * HUE_WHEEL_SIZE + 32768) >> 16;
+  if (index == HUE_WHEEL_SIZE) {
+    index = 0;
+  }
+
+  return s_hueWheel[index];
+}
@@ -0,0 +1,21 @@
+#include "Arduino.h"
+
+#ifndef HUE_WHEEL_H
+#define HUE_WHEEL_H
+
+// The number of distinct hues in the wheel. This matches Adafruit_NeoPixel::ColorHSV.
+#define HUE_WHEEL_SIZE 1530
+
+// Uncomment to store gamma-corrected colors in the hue wheel.
+// PixelBuffer already gamma-corrects its output when gamma correction is turned on,
+// so only use this when that's turned off, or the colors get corrected twice.
+//#define HUE_WHEEL_GAMMA
+
+// A lookup table of fully-saturated colors around the hue wheel, kept in flash.
+class HueWheel {
+  public:
+    // Gets the color for a hue. This gives the same color as Adafruit_NeoPixel::ColorHSV(hue).
+    static uint32_t getColor(uint16_t hue);
+};
+
+#endif
@@ -1,6 +1,6 @@
-#import "Arduino.h"
-#import "LightStyle.h"
-#import "PixelBuffer.h"
+#include "Arduino.h"
+#include "LightStyle.h"
+#include "PixelBuffer.h"
 
 std::vector<String> LightStyle::knownPatterns;
 
@@ -15,6 +15,8 @@ LightStyle::LightStyle(String name, PixelBuffer* pixelBuffer) {
     knownPatterns.push_back("Down");
     knownPatterns.push_back("Digit");
     knownPatterns.push_back("Random");
+    knownPatterns.push_back("Ripple");
+    knownPatterns.push_back("Spin");
   }
 }
 
@@ -26,6 +28,10 @@ void LightStyle::setStep(byte step) {
   m_step = step;
 }
 
+void LightStyle::setFreeRunning(bool isFreeRunning) {
+  m_isFreeRunning = isFreeRunning;
+}
+
 String LightStyle::getName() {
   return m_name;
 }
@@ -34,6 +40,15 @@ void LightStyle::setPattern(byte pattern) {
   m_pattern = pattern;
 }
 
+byte LightStyle::getPattern() {
+  return m_pattern;
+}
+
+StyleCapabilities LightStyle::getCapabilities() {
+  // The radial patterns need each pixel's position, so only the spatial styles have them.
+  return StyleCapabilities{ LIGHT_STYLE_SHIFTPATTERNS, 1, 100, 1, 100 };
+}
+
 int LightStyle::getNumberOfBlocksForPattern() {
   switch (m_pattern) {
     case 1:
@@ -45,9 +60,6 @@ int LightStyle::getNumberOfBlocksForPattern() {
     case 5:
     case 6:
       return m_pixelBuffer->getDigitCount();
-    case 7:
-    case 8:
-      return m_pixelBuffer->getPixelCount();
     default:
       // Default to Solid (ie, all lights the same color)
       return 1;
@@ -84,3 +96,51 @@ void LightStyle::shiftColorUsingPattern(uint32_t newColor) {
   }
 }
 
+
+bool LightStyle::canSetBlocksUsingPattern() {
+  // "Random" only has a block per digit, but each shift moves every pixel
+  // along the line, so the pixels outside the blocks depend on the shifting.
+  return m_pattern != 6;
+}
+
+void LightStyle::setBlockColorUsingPattern(int block, uint32_t color) {
+  switch (m_pattern) {
+    case 1: // Right
+      m_pixelBuffer->setColumnColor(block, color);
+      return;
+    case 2: // Left
+      m_pixelBuffer->setColumnColor(m_pixelBuffer->getColumnCount() - 1 - block, color);
+      return;
+    case 3: // Up
+      m_pixelBuffer->setRowColor(m_pixelBuffer->getRowCount() - 1 - block, color);
+      return;
+    case 4: // Down
+      m_pixelBuffer->setRowColor(block, color);
+      return;
+    case 5: // Digit
+      m_pixelBuffer->setDigitColor(block, color);
+      return;
+    default:
+      // Default to Solid (ie, all lights the same color)
+      for (int i = 0; i < m_pixelBuffer->getPixelCount(); i++) {
+        m_pixelBuffer->setPixel(i, color);
+      }
+  }
+}
+
+uint32_t LightStyle::getBlockColorUsingPattern(int block) {
+  switch (m_pattern) {
+    case 1: // Right
+      return m_pixelBuffer->getColumnColor(block);
+    case 2: // Left
+      return m_pixelBuffer->getColumnColor(m_pixelBuffer->getColumnCount() - 1 - block);
+    case 3: // Up
+      return m_pixelBuffer->getRowColor(m_pixelBuffer->getRowCount() - 1 - block);
+    case 4: // Down
+      return m_pixelBuffer->getRowColor(block);
+    case 5: // Digit
+      return m_pixelBuffer->getDigitColor(block);
+    default:
+      return m_pixelBuffer->getPixel(0);
+  }
+}
@@ -1,9 +1,27 @@
+#include <vector>
 #include "Arduino.h"
 #include "PixelBuffer.h"
 
 #ifndef LIGHT_STYLE_H
 #define LIGHT_STYLE_H
 
+// The patterns (Solid through Random) every style can draw by shifting colors along the blocks.
+// The radial patterns after them (Ripple and Spin) are only drawn by the spatial styles; the
+// shifting styles treat them as Solid.
+#define LIGHT_STYLE_SHIFTPATTERNS 0x7F
+
+// What a style does with the settings, for the catalogue sent to the phone app.
+struct StyleCapabilities {
+  // Bit N is set if the style supports knownPatterns[N].
+  uint16_t patterns;
+
+  // The ranges of speed and step the style uses. 0 to 0 means the setting isn't used.
+  byte minSpeed;
+  byte maxSpeed;
+  byte minStep;
+  byte maxStep;
+};
+
 class LightStyle {
   public:
     LightStyle(String name, PixelBuffer* pixelBuffer);
@@ -14,17 +32,24 @@ class LightStyle {
     static std::vector<String> knownPatterns;
 
     // Sets the frequency at which the light style updates.
-    void setSpeed(byte speed);
+    virtual void setSpeed(byte speed);
 
     // Sets the "step", which is defined by the style.
     // Examples would be the ratio of light-to-dark colors for 1- or 2-color styles,
     // or the amount of hue change for a rainbow style.
-    void setStep(byte step);
+    virtual void setStep(byte step);
 
     // Sets the display pattern, if supported by the style.
     // Use LIGHT_PATTERN_* macros to supply values.
     void setPattern(byte pattern);
 
+    // Gets the current display pattern.
+    byte getPattern();
+
+    // Gets the patterns and speed/step ranges the style supports.
+    // By default, that's every pattern and the full range of speed and step.
+    virtual StyleCapabilities getCapabilities();
+
     // Populates the buffer with a pattern of colors to show when the
     // light style has been selected.
     virtual void reset() = 0;
@@ -32,14 +57,29 @@ class LightStyle {
     // Updates the pixel buffer.
     virtual void update() = 0;
 
+    // Makes every update() do a step of work, however little time has passed since the last one.
+    // The benchmarks use this to time a batch of updates without waiting out the speed's delay.
+    void setFreeRunning(bool isFreeRunning);
+
   protected:
     PixelBuffer* m_pixelBuffer;
     String m_name;
     byte m_speed;
     byte m_step;
     byte m_pattern;
+    bool m_isFreeRunning{false};
 
     void shiftColorUsingPattern(uint32_t newColor);
+
+    // Sets or gets the color of one block in the pattern, without shifting.
+    // Blocks are counted from the one shiftColorUsingPattern puts the new color in,
+    // so block N holds the color that was shifted in N shifts ago.
+    void setBlockColorUsingPattern(int block, uint32_t color);
+    uint32_t getBlockColorUsingPattern(int block);
+
+    // Indicates the pattern's blocks can be set directly.
+    // Not true for "Random", which shifts the whole line.
+    bool canSetBlocksUsingPattern();
     int getNumberOfBlocksForPattern();
 };
    
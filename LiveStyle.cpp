@@ -0,0 +1,24 @@
+#include "Arduino.h"
+#include "LiveStyle.h"
+#include "PixelBuffer.h"
+#include "FrameStream.h"
+
+LiveStyle::LiveStyle(String name, FrameStream* frameStream, PixelBuffer* pixelBuffer) : LightStyle(name, pixelBuffer) {
+  m_frameStream = frameStream;
+}
+
+void LiveStyle::reset() {
+  // Show the last frame that was streamed, if any.
+  m_frameStream->copyFrame(m_pixelBuffer);
+}
+
+void LiveStyle::update() {
+  if (m_frameStream->hasNewFrame()) {
+    m_frameStream->copyFrame(m_pixelBuffer);
+  }
+}
+
+StyleCapabilities LiveStyle::getCapabilities() {
+  // The streamed frames ignore the pattern, speed, and step.
+  return StyleCapabilities{ 1, 0, 0, 0, 0 };
+}
@@ -0,0 +1,23 @@
+#include "LightStyle.h"
+#include "Arduino.h"
+#include "PixelBuffer.h"
+#include "FrameStream.h"
+
+#ifndef LIVE_STYLE_H
+#define LIVE_STYLE_H
+
+// Shows the frames streamed to the sign over BLE.
+// Speed, step, and pattern don't apply.
+class LiveStyle : public LightStyle {
+  public:
+    LiveStyle(String name, FrameStream* frameStream, PixelBuffer* pixelBuffer);
+
+    void reset();
+    void update();
+    StyleCapabilities getCapabilities();
+
+  private:
+    FrameStream* m_frameStream;
+};
+
+#endif
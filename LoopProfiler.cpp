@@ -0,0 +1,127 @@
+#include "Arduino.h"
+#include "LoopProfiler.h"
+
+static const char* s_phaseNames[LoopPhaseCount] = { "loop", "BLE", "buttons", "style", "display" };
+
+void LoopProfiler::record(LoopPhase phase, unsigned long elapsedMicros) {
+  uint16_t time = elapsedMicros > 0xFFFF ? 0xFFFF : elapsedMicros;
+  if (m_count[phase] == 0 || time < m_min[phase]) {
+    m_min[phase] = time;
+  }
+
+  if (time > m_max[phase]) {
+    m_max[phase] = time;
+  }
+
+  m_buckets[phase][getBucket(time)]++;
+  m_count[phase]++;
+}
+
+void LoopProfiler::printSummary() {
+  Serial.print("Loop timing (usec min/p50/p99/max):");
+  for (int phase = 0; phase < LoopPhaseCount; phase++) {
+    PhaseStats stats = getStats((LoopPhase)phase);
+    Serial.print(" ");
+    Serial.print(s_phaseNames[phase]);
+    Serial.print(" ");
+    Serial.print(stats.min);
+    Serial.print("/");
+    Serial.print(stats.p50);
+    Serial.print("/");
+    Serial.print(stats.p99);
+    Serial.print("/");
+    Serial.print(stats.max);
+    Serial.print(";");
+  }
+
+  Serial.println();
+}
+
+void LoopProfiler::getSummary(uint8_t* summary) {
+  *summary++ = LoopPhaseCount;
+  for (int phase = 0; phase < LoopPhaseCount; phase++) {
+    PhaseStats stats = getStats((LoopPhase)phase);
+    uint16_t values[] = { stats.min, stats.p50, stats.p99, stats.max };
+    for (int i = 0; i < 4; i++) {
+      *summary++ = values[i] & 0xFF;
+      *summary++ = values[i] >> 8;
+    }
+  }
+}
+
+void LoopProfiler::reset() {
+  memset(m_buckets, 0, sizeof(m_buckets));
+  memset(m_count, 0, sizeof(m_count));
+  memset(m_min, 0, sizeof(m_min));
+  memset(m_max, 0, sizeof(m_max));
+}
+
+LoopProfiler::PhaseStats LoopProfiler::getStats(LoopPhase phase) {
+  PhaseStats stats{0, 0, 0, 0};
+  if (m_count[phase] == 0) {
+    return stats;
+  }
+
+  stats.min = m_min[phase];
+  stats.p50 = getPercentile(phase, 50);
+  stats.p99 = getPercentile(phase, 99);
+  stats.max = m_max[phase];
+  return stats;
+}
+
+uint16_t LoopProfiler::getPercentile(LoopPhase phase, int percent) {
+  // Find the bucket holding the sample at that rank. Its top is never below
+  // the real time, but it can be above the max, so clamp it to the min and max.
+  uint32_t rank = (uint64_t)(m_count[phase] - 1) * percent / 100;
+  uint32_t seen = 0;
+  uint8_t bucket = 0;
+  while (bucket < LOOP_PROFILER_BUCKETS - 1) {
+    seen += m_buckets[phase][bucket];
+    if (seen > rank) {
+      break;
+    }
+
+    bucket++;
+  }
+
+  uint16_t time = getBucketTop(bucket);
+  if (time > m_max[phase]) {
+    return m_max[phase];
+  }
+
+  return time < m_min[phase] ? m_min[phase] : time;
+}
+
+uint8_t LoopProfiler::getBucket(uint16_t time) {
+  if (time < LOOP_PROFILER_EXACTBUCKETS) {
+    return time;
+  }
+
+  // The top bit picks the doubling, and the three bits under it pick the bucket within it.
+  int topBit = 4;
+  while ((time >> (topBit + 1)) != 0) {
+    topBit++;
+  }
+
+  return LOOP_PROFILER_EXACTBUCKETS + (topBit - 4) * LOOP_PROFILER_SUBBUCKETS + ((time >> (topBit - 3)) & 7);
+}
+
+uint16_t LoopProfiler::getBucketTop(uint8_t bucket) {
+  if (bucket < LOOP_PROFILER_EXACTBUCKETS) {
+    return bucket;
+  }
+
+  int topBit = 4 + (bucket - LOOP_PROFILER_EXACTBUCKETS) / LOOP_PROFILER_SUBBUCKETS;
+  uint32_t start = (uint32_t)(8 + (bucket - LOOP_PROFILER_EXACTBUCKETS) % LOOP_PROFILER_SUBBUCKETS) << (topBit - 3);
+  return start + (1 << (topBit - 3)) - 1;
+}
+
+ProfileTimer::ProfileTimer(LoopProfiler* profiler, LoopPhase phase) {
+  m_profiler = profiler;
+  m_phase = phase;
+  m_start = micros();
+}
+
+ProfileTimer::~ProfileTimer() {
+  m_profiler->record(m_phase, micros() - m_start);
+}
@@ -0,0 +1,76 @@
+#include "Arduino.h"
+
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+// The run times are counted in a histogram for each phase. Times under
+// LOOP_PROFILER_EXACTBUCKETS usec each have their own bucket; above that, each doubling
+// is split into LOOP_PROFILER_SUBBUCKETS buckets, so a bucket is within 1/8 of its time.
+#define LOOP_PROFILER_EXACTBUCKETS 16
+#define LOOP_PROFILER_SUBBUCKETS 8
+#define LOOP_PROFILER_BUCKETS (LOOP_PROFILER_EXACTBUCKETS + 12 * LOOP_PROFILER_SUBBUCKETS)
+
+// The parts of the main loop that are timed.
+enum LoopPhase : uint8_t {
+  LoopPhaseTotal,      // The whole loop.
+  LoopPhaseBle,        // Reading settings from BLE.
+  LoopPhaseButtons,    // Reading the manual style buttons.
+  LoopPhaseStyle,      // Updating the current style.
+  LoopPhaseDisplay,    // Rendering and sending the frame.
+  LoopPhaseCount
+};
+
+// The size of the binary summary: a phase count, then min/p50/p99/max for each phase.
+#define LOOP_PROFILER_SUMMARYSIZE (1 + LoopPhaseCount * 4 * 2)
+
+// Keeps a histogram of the run times (in usec) of each phase of the main loop,
+// covering every run since the last reset, so a single stutter isn't missed.
+class LoopProfiler {
+  public:
+    // Records a run time for a phase.
+    void record(LoopPhase phase, unsigned long elapsedMicros);
+
+    // Writes the min/p50/p99/max run times for each phase to the serial port.
+    void printSummary();
+
+    // Fills summary (LOOP_PROFILER_SUMMARYSIZE bytes) with a compact binary summary:
+    // the number of phases, then min, p50, p99, and max for each phase in LoopPhase order.
+    // Each time is a little-endian uint16 in usec, capped at 65535.
+    // The min and max are exact; the percentiles are the top of their histogram bucket.
+    void getSummary(uint8_t* summary);
+
+    // Clears the run times, to start a new reporting interval.
+    void reset();
+
+  private:
+    struct PhaseStats {
+      uint16_t min;
+      uint16_t p50;
+      uint16_t p99;
+      uint16_t max;
+    };
+
+    uint32_t m_buckets[LoopPhaseCount][LOOP_PROFILER_BUCKETS]{};
+    uint32_t m_count[LoopPhaseCount]{};
+    uint16_t m_min[LoopPhaseCount]{};
+    uint16_t m_max[LoopPhaseCount]{};
+
+    PhaseStats getStats(LoopPhase phase);
+    uint16_t getPercentile(LoopPhase phase, int percent);
+    static uint8_t getBucket(uint16_t time);
+    static uint16_t getBucketTop(uint8_t bucket);
+};
+
+// Records the time from its creation to the end of its scope.
+class ProfileTimer {
+  public:
+    ProfileTimer(LoopProfiler* profiler, LoopPhase phase);
+    ~ProfileTimer();
+
+  private:
+    LoopProfiler* m_profiler;
+    LoopPhase m_phase;
+    unsigned long m_start;
+};
+
+#endif
@@ -1,16 +1,47 @@
 #include <Adafruit_NeoPixel.h>
-#include <vector>
 #include "Arduino.h"
+#include "PixelLayouts.h"
 
 #ifndef PIXEL_BUFFER_H
 #define PIXEL_BUFFER_H
 
+// The gamma curve used for dithered output. This matches Adafruit_NeoPixel::gamma8.
+#define PIXEL_BUFFER_GAMMA 2.6f
+
+// The physical pixel layout to use. See PixelLayouts.h for the available layouts.
+#define PIXEL_BUFFER_LAYOUT SignLayout
+//#define PIXEL_BUFFER_LAYOUT TestRingLayout
+namespace ActiveLayout = PIXEL_BUFFER_LAYOUT;
+static_assert(sizeof(ActiveLayout::Pixels) / sizeof(PixelInfo) == ActiveLayout::PixelCount, "The layout needs a PixelInfo for each pixel.");
+static_assert(ActiveLayout::Rows.blockCount < PIXEL_LAYOUTS_NOBLOCK && ActiveLayout::Columns.blockCount < PIXEL_LAYOUTS_NOBLOCK
+  && ActiveLayout::Digits.blockCount < PIXEL_LAYOUTS_NOBLOCK, "Block indices must fit in a byte.");
+
+// The most layers that can be drawn on top of the pixels at once.
+#define PIXEL_BUFFER_MAXLAYERS 4
+
+class PixelLayer;
+
 class PixelBuffer {
+  // The benchmarks time the frame rendering directly.
+  friend class Benchmarks;
+
   public:
+    // The row/column/digit index reported for a pixel that isn't in one.
+    static constexpr uint8_t NoBlock = PIXEL_LAYOUTS_NOBLOCK;
+
     PixelBuffer(int16_t gpioPin);
     void setBrightness(uint8_t brightess);
     void initialize();
 
+    // Turns gamma correction of the output colors on or off.
+    // Gamma correction makes low-intensity colors look closer to how they're intended.
+    void setGammaCorrection(bool isGammaCorrected);
+
+    // Turns temporal dithering of the output colors on or off.
+    // Dithering smooths out fades and hue steps at low brightness, but it needs
+    // a new frame sent at the frame rate even when the pixels don't change.
+    void setDithering(bool isDithered);
+
     // Sets the first pixel in the buffer to the new color,
     // shifting all the pixels in the buffer to the right by one.
     void shiftLineRight(uint32_t newColor);
@@ -43,6 +74,15 @@ class PixelBuffer {
     // shifting all the rows down by one.
     void shiftRowsDown(uint32_t newColor);
 
+    // Sets all the pixels in a column/row/digit to a color, or gets the column/row/digit's color.
+    // Like the shifts, these only write the pixels out when the frame is displayed.
+    void setColumnColor(unsigned int column, uint32_t color);
+    uint32_t getColumnColor(unsigned int column);
+    void setRowColor(unsigned int row, uint32_t color);
+    uint32_t getRowColor(unsigned int row);
+    void setDigitColor(unsigned int digit, uint32_t color);
+    uint32_t getDigitColor(unsigned int digit);
+
     // Gets the number of pixels in the buffer.
     unsigned int getPixelCount();
 
@@ -58,28 +98,143 @@ class PixelBuffer {
     // Might not be needed? Even if needed, it should always be 4 anyways.
     unsigned int getDigitCount();
 
+    // Gets the column a pixel is in (0 is the left column), or NoBlock.
+    uint8_t getPixelColumn(unsigned int pixel);
+
+    // Gets the row a pixel is in (0 is the top row), or NoBlock.
+    uint8_t getPixelRow(unsigned int pixel);
+
+    // Gets the digit a pixel is in (0 is the left digit), or NoBlock.
+    uint8_t getPixelDigit(unsigned int pixel);
+
+    // Gets the position information for a pixel.
+    // This is a single table read, so it's cheap enough to use for every pixel in every frame.
+    PixelInfo getPixelInfo(unsigned int pixel);
+
+    // Copies the color of every pixel in the buffer into colors, which must hold getPixelCount() entries.
+    // Layers aren't included.
+    void getPixels(uint32_t* colors);
+
+    // Gets the color of an individual pixel in the buffer.
+    uint32_t getPixel(unsigned int pixel);
+
+    // Gets the color of a pixel with every active layer blended on top, the way the
+    // next frame renders it (before gamma and brightness).
+    uint32_t getBlendedPixel(unsigned int pixel);
+
     // Set an individual pixel in the buffer to a color.
     void setPixel(unsigned int pixel, uint32_t color);
 
     // Output the interal pixel buffer to the NeoPixel LEDs.
+    // Does nothing if the buffer hasn't changed since the last call.
+    // This does not wait: if the previous frame is still latching or the frame
+    // period hasn't passed, the frame is sent on a later call instead.
     void displayPixels();
 
+    // Waits until the next call to displayPixels() can send a frame.
+    void waitForFrame();
+
+    // Indicates a frame can be sent now.
+    bool isReadyForFrame();
+
+    // Indicates the LEDs are still latching the last frame, or are within the
+    // guard interval after it. BLE reads are not reliable during this time.
+    bool isLatching();
+
+    // Sets the maximum number of frames sent to the LEDs per second.
+    void setFrameRate(uint8_t framesPerSecond);
+
+    // Sets the time (in msec) after the start of a "show" during which isLatching() stays true.
+    void setShowGuardInterval(unsigned int msec);
+
+    // Indicates the buffer (or brightness, or a layer) has changed since the last frame was displayed.
+    bool isDirty();
+
+    // Adds a layer to be blended on top of the pixels when the frame is rendered.
+    // Layers are blended in the order they're added. Returns false if there's no room.
+    bool addLayer(PixelLayer* layer);
+
+    // Removes a layer added with addLayer().
+    void removeLayer(PixelLayer* layer);
+
+    // Writes every frame sent to the LEDs to output as a binary record (null turns it off).
+    // Each record is: "PXFR", frame number (uint32), timestamp in usec (uint32),
+    // pixel count (uint16), then the G,R,B bytes for each pixel exactly as they were sent
+    // to the strip, with gamma and brightness applied. All values are little-endian.
+    // The host simulator uses this to save the frames to a file.
+    void setCaptureOutput(Print* output);
+
     // Clears the internal pixel buffer, but does not reset the NeoPixel LEDs.
     void clearBuffer();
 
+    // Gets the total number of pixel writes made to the buffer so far.
+    // Used for benchmarking.
+    unsigned long getPixelWriteCount();
+
   private:
-    Adafruit_NeoPixel* m_neoPixels;
-    unsigned int m_numPixels;
-    uint32_t* m_pixelColors;
-    std::vector<std::vector<int>*> m_columns;
-    std::vector<std::vector<int>*> m_rows;
-    std::vector<std::vector<int>*> m_digits;
-
-    void initializeSignBuffer(int16_t gpioPin);
-    void initializeTestRingBuffer(int16_t gpioPin);
-    void setColorForMappedPixels(std::vector<int>* destination, uint32_t newColor);
-    void shiftPixelBlocksRight(std::vector<std::vector<int>*> pixelBlocks, uint32_t newColor);
-    void shiftPixelBlocksLeft(std::vector<std::vector<int>*> pixelBlocks, uint32_t newColor);
+    // Which set of blocks (if any) m_blockColors currently holds.
+    // For LineRing, each pixel is its own block.
+    enum BlockRing : uint8_t { NoRing, RowRing, ColumnRing, DigitRing, LineRing };
+
+    Adafruit_NeoPixel m_neoPixels;
+    uint32_t m_pixelColors[ActiveLayout::PixelCount];
+
+    // The frame in the strip's wire format (GRB), with brightness applied.
+    // It's rendered just before it's sent, then copied into the strip's pixel array.
+    uint8_t m_frameBytes[ActiveLayout::PixelCount * 3];
+
+    // Maps each 8-bit color channel to its output value, with gamma
+    // correction (if enabled) and brightness applied.
+    uint8_t m_outputTable[256];
+    uint8_t m_brightness{255};
+    bool m_isGammaCorrected{false};
+
+    // The output table for dithering, in 8.8 fixed point, and the
+    // fraction carried over to the next frame for each byte of the frame.
+    uint16_t m_ditheredOutputTable[256];
+    uint8_t m_ditherErrors[ActiveLayout::PixelCount * 3];
+    bool m_isDithered{false};
+
+    // Row/column/digit/line shifts keep one color per block in a ring buffer.
+    // A shift just moves the head of the ring; the pixel colors are only
+    // written out when the frame is displayed or a pixel is set directly.
+    // Block N's color is m_blockColors[(m_blockHead + N) % m_blockCount].
+    uint32_t m_blockColors[ActiveLayout::PixelCount];
+    uint16_t m_blockHead{0};
+    uint16_t m_blockCount{0};
+    BlockRing m_activeRing{NoRing};
+    uint8_t PixelInfo::* m_activeBlockField{nullptr};
+
+    // The layers drawn on top of m_pixelColors, bottom first.
+    PixelLayer* m_layers[PIXEL_BUFFER_MAXLAYERS];
+    uint8_t m_layerCount{0};
+
+    bool m_isDirty{true};
+    bool m_hasShown{false};
+    unsigned long m_lastShowMicros{0};
+    unsigned long m_framePeriodMicros{0};
+    unsigned long m_showGuardMicros{10000};
+    uint32_t m_frameCount{0};
+    Print* m_captureOutput{nullptr};
+    unsigned long m_pixelWriteCount{0};
+
+    template <const PixelBlockMap& Blocks> uint16_t getFirstPixelInBlock(int block);
+    template <const PixelBlockMap& Blocks> void useBlockRing(BlockRing ring, uint8_t PixelInfo::* blockField);
+    template <const PixelBlockMap& Blocks> void shiftPixelBlocksRight(BlockRing ring, uint8_t PixelInfo::* blockField, uint32_t newColor);
+    template <const PixelBlockMap& Blocks> void shiftPixelBlocksLeft(BlockRing ring, uint8_t PixelInfo::* blockField, uint32_t newColor);
+    template <const PixelBlockMap& Blocks> void setPixelBlockColor(BlockRing ring, uint8_t PixelInfo::* blockField, unsigned int block, uint32_t color);
+    template <const PixelBlockMap& Blocks> uint32_t getPixelBlockColor(BlockRing ring, uint8_t PixelInfo::* blockField, unsigned int block);
+    void useLineRing();
+    void rotateRingRight(uint32_t newColor);
+    void rotateRingLeft(uint32_t newColor);
+    void renderBlockRing();
+    void renderFrame();
+    void renderDitheredFrame();
+    void buildOutputTable();
+    bool isLayerDirty();
+    uint8_t getActiveLayers(PixelLayer** activeLayers);
+    void releaseBlockRing();
+    void captureFrame();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "Arduino.h"
+#include "PixelLayer.h"
+#include "PixelBuffer.h"
+
+PixelLayer::PixelLayer(BlendMode blendMode) {
+  m_blendMode = blendMode;
+  clear();
+}
+
+void PixelLayer::setBlendMode(BlendMode blendMode) {
+  m_blendMode = blendMode;
+  m_isDirty = true;
+}
+
+BlendMode PixelLayer::getBlendMode() {
+  return m_blendMode;
+}
+
+void PixelLayer::setAlpha(uint8_t alpha) {
+  m_alpha = alpha;
+  m_isDirty = true;
+}
+
+uint8_t PixelLayer::getAlpha() {
+  return m_alpha;
+}
+
+void PixelLayer::setEnabled(bool isEnabled) {
+  m_isEnabled = isEnabled;
+  m_isDirty = true;
+}
+
+bool PixelLayer::isActive() {
+  return m_isEnabled && m_alpha > 0;
+}
+
+void PixelLayer::setPixel(unsigned int pixel, uint32_t color, uint8_t alpha) {
+  if (pixel >= ActiveLayout::PixelCount) {
+    return;
+  }
+
+  m_colors[pixel] = ((uint32_t)alpha << 24) | (color & 0xFFFFFF);
+  m_isDirty = true;
+}
+
+void PixelLayer::fill(uint32_t color, uint8_t alpha) {
+  uint32_t layerColor = ((uint32_t)alpha << 24) | (color & 0xFFFFFF);
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    m_colors[i] = layerColor;
+  }
+
+  m_isDirty = true;
+}
+
+void PixelLayer::copyBlendedPixels(PixelBuffer* pixelBuffer) {
+  // Each pixel is blended before it's overwritten, so this layer's old pixels are still used.
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    m_colors[i] = pixelBuffer->getBlendedPixel(i) | 0xFF000000;
+  }
+
+  m_isDirty = true;
+}
+
+void PixelLayer::clear() {
+  fill(0, 0);
+}
+
+bool PixelLayer::isDirty() {
+  return m_isDirty;
+}
+
+void PixelLayer::clearDirty() {
+  m_isDirty = false;
+}
+
+uint32_t PixelLayer::blendPixel(unsigned int pixel, uint32_t color) {
+  uint32_t layerColor = m_colors[pixel];
+  uint8_t pixelAlpha = layerColor >> 24;
+  if (pixelAlpha == 0) {
+    return color;
+  }
+
+  uint32_t blended;
+  switch (m_blendMode) {
+    case BlendMode::Add:
+      blended = blendAdd(color, layerColor);
+      break;
+    case BlendMode::Max:
+      blended = blendMax(color, layerColor);
+      break;
+    case BlendMode::Multiply:
+      blended = blendMultiply(color, layerColor);
+      break;
+    default:
+      blended = layerColor & 0xFFFFFF;
+  }
+
+  // The pixel and layer alphas combined, from 0 (none of the layer shows, as when the
+  // layer alpha is 0 or both alphas are small) to 256 (both are 255, fully blended).
+  uint16_t amount = ((pixelAlpha + 1) * (m_alpha + 1)) >> 8;
+  if (amount == 256) {
+    return blended;
+  }
+
+  return mix(color, blended, amount);
+}
+
+// The blend kernels work on whole 0x00RRGGBB pixels. Red and blue are handled together
+// in the 0x00FF00FF lanes and green in the 0x0000FF00 lane, so each lane has 8 bits
+// of headroom above it for carries.
+
+uint32_t PixelLayer::blendAdd(uint32_t color, uint32_t layerColor) {
+  uint32_t redBlue = (color & 0xFF00FF) + (layerColor & 0xFF00FF);
+  uint32_t green = (color & 0xFF00) + (layerColor & 0xFF00);
+
+  // A carry out of a lane turns into 0xFF across that lane.
+  uint32_t carries = redBlue & 0x1000100;
+  redBlue = (redBlue | (carries - (carries >> 8))) & 0xFF00FF;
+  carries = green & 0x10000;
+  green = (green | (carries - (carries >> 8))) & 0xFF00;
+  return redBlue | green;
+}
+
+uint32_t PixelLayer::blendMax(uint32_t color, uint32_t layerColor) {
+  // max(a, b) = b + max(a - b, 0). Setting the bit above each lane before subtracting
+  // leaves it set only in the lanes where a >= b.
+  uint32_t layerRedBlue = layerColor & 0xFF00FF;
+  uint32_t layerGreen = layerColor & 0xFF00;
+  uint32_t redBlue = ((color & 0xFF00FF) | 0x1000100) - layerRedBlue;
+  uint32_t green = ((color & 0xFF00) | 0x10000) - layerGreen;
+
+  uint32_t keep = redBlue & 0x1000100;
+  redBlue &= keep - (keep >> 8);
+  keep = green & 0x10000;
+  green &= keep - (keep >> 8);
+  return (layerRedBlue + redBlue) | (layerGreen + green);
+}
+
+uint32_t PixelLayer::blendMultiply(uint32_t color, uint32_t layerColor) {
+  // Each lane has a different multiplier, so the channels are done one at a time.
+  // Multiplying by (n + 1) / 256 keeps white (255) as "no change".
+  uint32_t red = ((color >> 16) & 0xFF) * (((layerColor >> 16) & 0xFF) + 1) >> 8;
+  uint32_t green = ((color >> 8) & 0xFF) * (((layerColor >> 8) & 0xFF) + 1) >> 8;
+  uint32_t blue = (color & 0xFF) * ((layerColor & 0xFF) + 1) >> 8;
+  return (red << 16) | (green << 8) | blue;
+}
+
+uint32_t PixelLayer::mix(uint32_t color, uint32_t blended, uint16_t amount) {
+  // The weights add up to 256, so neither lane can overflow into the next.
+  uint16_t remaining = 256 - amount;
+  uint32_t redBlue = ((color & 0xFF00FF) * remaining + (blended & 0xFF00FF) * amount) >> 8;
+  uint32_t green = ((color & 0xFF00) * remaining + (blended & 0xFF00) * amount) >> 8;
+  return (redBlue & 0xFF00FF) | (green & 0xFF00);
+}
@@ -0,0 +1,69 @@
+#include "Arduino.h"
+#include "PixelBuffer.h"
+
+#ifndef PIXEL_LAYER_H
+#define PIXEL_LAYER_H
+
+// How a layer's colors are combined with the colors underneath it.
+enum class BlendMode : uint8_t {
+  Over,      // The layer's color replaces the color underneath.
+  Add,       // The colors are added, clipping at full brightness.
+  Max,       // The brighter of the two, for each channel.
+  Multiply   // The colors are multiplied, so the layer darkens or tints what's underneath.
+};
+
+// A buffer of colors drawn on top of the PixelBuffer's pixels.
+// Each pixel also has its own alpha (0 = transparent, 255 = opaque), which is
+// combined with the layer's alpha to decide how much of the blend shows.
+// A cleared layer is fully transparent.
+class PixelLayer {
+  public:
+    PixelLayer(BlendMode blendMode);
+
+    void setBlendMode(BlendMode blendMode);
+    BlendMode getBlendMode();
+
+    // Sets how much of the whole layer shows, from 0 (hidden) to 255.
+    void setAlpha(uint8_t alpha);
+    uint8_t getAlpha();
+
+    // Turns the layer on or off. A layer that's off (or has an alpha of 0) isn't composited at all.
+    void setEnabled(bool isEnabled);
+    bool isActive();
+
+    // Sets a pixel in the layer. The alpha defaults to fully opaque.
+    void setPixel(unsigned int pixel, uint32_t color, uint8_t alpha = 255);
+
+    // Sets every pixel in the layer to the same color.
+    void fill(uint32_t color, uint8_t alpha = 255);
+
+    // Copies what the PixelBuffer would show into the layer, fully opaque: its pixels with
+    // every active layer (this one included) blended on top.
+    void copyBlendedPixels(PixelBuffer* pixelBuffer);
+
+    // Makes every pixel in the layer transparent.
+    void clear();
+
+    // Indicates the layer has changed since the last call to clearDirty().
+    bool isDirty();
+    void clearDirty();
+
+    // Blends this layer's pixel on top of a color.
+    // The color and the result are both 0x00RRGGBB.
+    uint32_t blendPixel(unsigned int pixel, uint32_t color);
+
+  private:
+    // 0xAARRGGBB, where AA is the pixel's alpha.
+    uint32_t m_colors[ActiveLayout::PixelCount];
+    BlendMode m_blendMode;
+    uint8_t m_alpha{255};
+    bool m_isEnabled{true};
+    bool m_isDirty{true};
+
+    static uint32_t blendAdd(uint32_t color, uint32_t layerColor);
+    static uint32_t blendMax(uint32_t color, uint32_t layerColor);
+    static uint32_t blendMultiply(uint32_t color, uint32_t layerColor);
+    static uint32_t mix(uint32_t color, uint32_t blended, uint16_t amount);
+};
+
+#endif
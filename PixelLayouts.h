@@ -0,0 +1,312 @@
+#include <stdint.h>
+
+#ifndef PIXEL_LAYOUTS_H
+#define PIXEL_LAYOUTS_H
+
+// A set of pixel blocks (rows, columns, or digits) stored as one flat table.
+// The pixels for block N are pixels[offsets[N]] up to (but not including) pixels[offsets[N+1]].
+// If hasPixels is false (and pixels is null), each block is the contiguous range of pixel
+// indices offsets[N] to offsets[N+1]-1. hasPixels is a separate constant so the code can
+// branch on it without comparing the address of a table to null.
+struct PixelBlockMap {
+  const uint16_t* offsets;
+  const uint16_t* pixels;
+  uint16_t blockCount;
+  bool hasPixels;
+};
+
+// The row/column/digit index of a pixel that isn't in one.
+#define PIXEL_LAYOUTS_NOBLOCK 0xFF
+
+// Where a pixel is on the sign. Each layout has a table of these, one for each pixel.
+struct PixelInfo {
+  // The column/row/digit the pixel is in, or PIXEL_LAYOUTS_NOBLOCK if it isn't in one.
+  uint8_t column;
+  uint8_t row;
+  uint8_t digit;
+
+  // The position on the sign, from 0 (left/top) to 255 (right/bottom).
+  uint8_t x;
+  uint8_t y;
+
+  // The direction from the center of the sign, in 1/256ths of a turn.
+  // 0 points right, and the angle increases clockwise (towards the bottom).
+  uint8_t angle;
+
+  // The distance from the center of the sign, from 0 up to 255 at the corners.
+  uint8_t radius;
+};
+
+// Each layout describes one physical arrangement of NeoPixels.
+// A layout needs a PixelCount, Rows, Columns, and Digits block maps, and a Pixels table.
+// The Pixels table is generated from the block maps by host/GeneratePixelInfo; being
+// constexpr, it stays in flash instead of being built in RAM at startup.
+// To support a new sign, add a layout here and select it in PixelBuffer.h.
+//
+// ROW 0 is at the TOP of the display.
+// COLUMN 0 is at the LEFT of the display.
+// DIGIT 0 is at the LEFT of the display.
+
+#define PIXEL_LAYOUTS_BLOCKCOUNT(offsets) (sizeof(offsets) / sizeof(offsets[0]) - 1)
+
+// The "3181" sign.
+namespace SignLayout {
+  constexpr uint16_t PixelCount = 458;
+
+  constexpr uint16_t RowOffsets[] = {
+    0,24,55,84,116,144,168,185,207,226,242,258,279,301,318,342,
+    362,386,409,434,458
+  };
+  constexpr uint16_t RowPixels[] = {
+    18,19,20,21,22,23,24,25,124,125,126,127,215,216,217,218,329,330,331,332,367,368,369,370,
+    14,15,16,17,26,27,28,29,30,128,129,130,131,132,133,219,220,221,222,223,333,334,335,336,337,371,372,373,374,375,376,
+    11,12,13,31,32,33,34,134,135,136,137,138,139,140,224,225,226,227,338,339,340,341,377,378,379,380,381,382,383,
+    7,8,9,10,35,36,37,38,141,142,143,144,145,146,147,148,228,229,230,231,342,343,344,345,384,385,386,387,388,389,390,391,
+    4,5,6,39,40,41,149,150,151,152,153,154,155,156,232,233,234,346,347,348,392,393,394,395,396,397,398,399,
+    0,1,2,3,42,43,44,45,157,158,159,160,235,236,237,238,349,350,351,352,400,401,402,403,
+    46,47,48,161,162,163,164,239,240,241,353,354,355,404,405,406,407,
+    49,50,51,52,165,166,167,168,242,243,244,245,246,356,357,358,359,360,408,409,410,411,
+    53,54,55,56,57,169,170,171,247,248,249,250,361,362,363,364,412,413,414,
+    58,59,60,61,172,173,174,175,251,252,365,366,415,416,417,418,
+    98,99,100,101,176,177,178,179,289,290,327,328,419,420,421,422,
+    93,94,95,96,97,180,181,182,183,285,286,287,288,323,324,325,326,423,424,425,426,
+    89,90,91,92,184,185,186,187,280,281,282,283,284,318,319,320,321,322,427,428,429,430,
+    86,87,88,188,189,190,191,277,278,279,315,316,317,431,432,433,434,
+    82,83,84,85,102,103,104,105,192,193,194,195,273,274,275,276,311,312,313,314,435,436,437,438,
+    79,80,81,106,107,108,196,197,198,199,270,271,272,308,309,310,439,440,441,442,
+    75,76,77,78,109,110,111,112,200,201,202,203,266,267,268,269,304,305,306,307,443,444,445,446,
+    71,72,73,74,113,114,115,204,205,206,207,262,263,264,265,300,301,302,303,447,448,449,450,
+    66,67,68,69,70,116,117,118,119,208,209,210,257,258,259,260,261,295,296,297,298,299,451,452,453,
+    62,63,64,65,120,121,122,123,211,212,213,214,253,254,255,256,291,292,293,294,454,455,456,457
+  };
+
+  constexpr uint16_t ColumnOffsets[] = {
+    0,4,8,14,20,26,32,38,40,44,48,50,54,58,64,74,
+    84,92,102,110,116,124,125,126,128,129,131,133,135,137,145,155,
+    165,175,185,195,205,215,221,229,237,247,255,265,275,281,287,291,
+    295,301,307,317,327,335,345,353,359,367,368,369,371,372,374,376,
+    378,380,388,398,408,418,428,438,448,458
+  };
+  constexpr uint16_t ColumnPixels[] = {
+    7,0,102,109,
+    11,4,106,113,
+    14,8,1,103,110,116,
+    18,12,5,107,114,120,
+    15,9,2,104,111,117,
+    19,13,6,108,115,121,
+    16,10,3,105,112,118,
+    20,122,
+    17,58,98,119,
+    21,53,93,123,
+    59,99,
+    22,54,94,62,
+    26,60,100,66,
+    23,31,55,95,71,63,
+    27,35,42,49,61,101,89,82,75,67,
+    24,32,39,46,56,96,86,79,72,64,
+    28,36,43,50,90,83,76,68,
+    25,33,40,47,57,97,87,80,73,65,
+    29,37,44,51,91,84,77,69,
+    34,41,48,88,81,74,
+    30,38,45,52,92,85,78,70,
+    149,
+    141,
+    134,150,
+    142,
+    135,151,
+    128,143,
+    136,152,
+    129,144,
+    124,137,153,161,176,184,192,200,
+    130,145,157,165,172,180,188,196,204,211,
+    125,138,154,162,169,177,185,193,201,208,
+    131,146,158,166,173,181,189,197,205,212,
+    126,139,155,163,170,178,186,194,202,209,
+    132,147,159,167,174,182,190,198,206,213,
+    127,140,156,164,171,179,187,195,203,210,
+    133,148,160,168,175,183,191,199,207,214,
+    261,269,276,238,231,223,
+    265,272,279,284,246,241,234,227,
+    260,268,275,283,245,237,230,222,
+    256,264,271,278,288,250,240,233,226,218,
+    259,267,274,282,244,236,229,221,
+    255,263,270,277,287,249,239,232,225,217,
+    258,266,273,281,290,252,243,235,228,220,
+    254,262,286,248,224,216,
+    257,280,289,251,242,219,
+    253,285,247,215,
+    291,323,361,329,
+    295,318,327,365,356,333,
+    292,300,324,362,338,330,
+    296,304,311,319,328,366,357,349,342,334,
+    293,301,308,315,325,363,353,346,339,331,
+    297,305,312,320,358,350,343,335,
+    294,302,309,316,326,364,354,347,340,332,
+    298,306,313,321,359,351,344,336,
+    303,310,317,355,348,341,
+    299,307,314,322,360,352,345,337,
+    392,
+    384,
+    377,393,
+    385,
+    378,394,
+    371,386,
+    379,395,
+    372,387,
+    367,380,396,404,419,427,435,443,
+    373,388,400,408,415,423,431,439,447,454,
+    368,381,397,405,412,420,428,436,444,451,
+    374,389,401,409,416,424,432,440,448,455,
+    369,382,398,406,413,421,429,437,445,452,
+    375,390,402,410,417,425,433,441,449,456,
+    370,383,399,407,414,422,430,438,446,453,
+    376,391,403,411,418,426,434,442,450,457
+  };
+
+  // Digits are contiguous, so only the offsets are needed.
+  // The digits are "3", "1", "8", "1".
+  constexpr uint16_t DigitOffsets[] = {
+    0,124,215,367,458
+  };
+
+  constexpr PixelBlockMap Rows = { RowOffsets, RowPixels, PIXEL_LAYOUTS_BLOCKCOUNT(RowOffsets), true };
+  constexpr PixelBlockMap Columns = { ColumnOffsets, ColumnPixels, PIXEL_LAYOUTS_BLOCKCOUNT(ColumnOffsets), true };
+  constexpr PixelBlockMap Digits = { DigitOffsets, nullptr, PIXEL_LAYOUTS_BLOCKCOUNT(DigitOffsets), false };
+
+  // Generated by host/GeneratePixelInfo from the block maps above. Don't edit by hand.
+  // Each entry is { column, row, digit, x, y, angle, radius }.
+  constexpr PixelInfo Pixels[] = {
+    {0,5,0,0,67,133,248}, {2,5,0,7,67,133,235}, {4,5,0,14,67,134,221}, {6,5,0,21,67,134,208}, {1,4,0,4,54,134,243}, {3,4,0,11,54,135,229},
+    {5,4,0,18,54,135,216}, {0,3,0,0,40,135,251}, {2,3,0,7,40,136,237}, {4,3,0,14,40,136,224}, {6,3,0,21,40,137,210}, {1,2,0,4,27,137,245},
+    {3,2,0,11,27,137,232}, {5,2,0,18,27,138,218}, {2,1,0,7,13,138,240}, {4,1,0,14,13,139,227}, {6,1,0,21,13,139,214}, {8,1,0,28,13,140,200},
+    {3,0,0,11,0,139,235}, {5,0,0,18,0,140,222}, {7,0,0,25,0,141,209}, {9,0,0,32,0,142,196}, {11,0,0,39,0,143,183}, {13,0,0,46,0,144,170},
+    {15,0,0,53,0,145,158}, {17,0,0,60,0,147,145}, {12,1,0,43,13,142,174}, {14,1,0,50,13,143,162}, {16,1,0,57,13,144,149}, {18,1,0,64,13,146,136},
+    {20,1,0,71,13,148,124}, {13,2,0,46,27,141,166}, {15,2,0,53,27,142,153}, {17,2,0,60,27,143,140}, {19,2,0,67,27,145,127}, {14,3,0,50,40,140,157},
+    {16,3,0,57,40,141,144}, {18,3,0,64,40,142,131}, {20,3,0,71,40,144,118}, {15,4,0,53,54,138,149}, {17,4,0,60,54,139,135}, {19,4,0,67,54,141,122},
+    {14,5,0,50,67,136,154}, {16,5,0,57,67,137,140}, {18,5,0,64,67,138,127}, {20,5,0,71,67,139,114}, {15,6,0,53,81,135,146}, {17,6,0,60,81,135,132},
+    {19,6,0,67,81,136,119}, {14,7,0,50,94,133,152}, {16,7,0,57,94,133,138}, {18,7,0,64,94,134,124}, {20,7,0,71,94,134,111}, {9,8,0,32,107,130,185},
+    {11,8,0,39,107,130,172}, {13,8,0,46,107,131,158}, {15,8,0,53,107,131,144}, {17,8,0,60,107,131,131}, {8,9,0,28,121,129,192}, {10,9,0,35,121,129,178},
+    {12,9,0,43,121,129,164}, {14,9,0,50,121,129,151}, {11,19,0,39,255,113,183}, {13,19,0,46,255,112,170}, {15,19,0,53,255,111,158}, {17,19,0,60,255,109,145},
+    {12,18,0,43,242,114,174}, {14,18,0,50,242,113,162}, {16,18,0,57,242,112,149}, {18,18,0,64,242,110,136}, {20,18,0,71,242,108,124}, {13,17,0,46,228,115,166},
+    {15,17,0,53,228,114,153}, {17,17,0,60,228,113,140}, {19,17,0,67,228,111,127}, {14,16,0,50,215,116,157}, {16,16,0,57,215,115,144}, {18,16,0,64,215,114,131},
+    {20,16,0,71,215,112,118}, {15,15,0,53,201,118,149}, {17,15,0,60,201,117,135}, {19,15,0,67,201,115,122}, {14,14,0,50,188,120,154}, {16,14,0,57,188,119,140},
+    {18,14,0,64,188,118,127}, {20,14,0,71,188,117,114}, {15,13,0,53,174,121,146}, {17,13,0,60,174,121,132}, {19,13,0,67,174,120,119}, {14,12,0,50,161,123,152},
+    {16,12,0,57,161,123,138}, {18,12,0,64,161,122,124}, {20,12,0,71,161,122,111}, {9,11,0,32,148,126,185}, {11,11,0,39,148,126,172}, {13,11,0,46,148,125,158},
+    {15,11,0,53,148,125,144}, {17,11,0,60,148,125,131}, {8,10,0,28,134,127,192}, {10,10,0,35,134,127,178}, {12,10,0,43,134,127,164}, {14,10,0,50,134,127,151},
+    {0,14,0,0,188,123,248}, {2,14,0,7,188,123,235}, {4,14,0,14,188,122,221}, {6,14,0,21,188,122,208}, {1,15,0,4,201,122,243}, {3,15,0,11,201,121,229},
+    {5,15,0,18,201,121,216}, {0,16,0,0,215,121,251}, {2,16,0,7,215,120,237}, {4,16,0,14,215,120,224}, {6,16,0,21,215,119,210}, {1,17,0,4,228,119,245},
+    {3,17,0,11,228,119,232}, {5,17,0,18,228,118,218}, {2,18,0,7,242,118,240}, {4,18,0,14,242,117,227}, {6,18,0,21,242,117,214}, {8,18,0,28,242,116,200},
+    {3,19,0,11,255,117,235}, {5,19,0,18,255,116,222}, {7,19,0,25,255,115,209}, {9,19,0,32,255,114,196}, {29,0,1,103,0,166,81}, {31,0,1,110,0,172,74},
+    {33,0,1,117,0,180,68}, {35,0,1,124,0,188,65}, {26,1,1,92,13,157,90}, {28,1,1,99,13,161,80}, {30,1,1,106,13,167,71}, {32,1,1,113,13,174,64},
+    {34,1,1,120,13,183,60}, {36,1,1,128,13,192,58}, {23,2,1,81,27,149,103}, {25,2,1,89,27,152,91}, {27,2,1,96,27,156,80}, {29,2,1,103,27,161,70},
+    {31,2,1,110,27,168,62}, {33,2,1,117,27,176,55}, {35,2,1,124,27,187,52}, {22,3,1,78,40,146,106}, {24,3,1,85,40,148,93}, {26,3,1,92,40,151,82},
+    {28,3,1,99,40,156,71}, {30,3,1,106,40,162,61}, {32,3,1,113,40,170,52}, {34,3,1,120,40,180,47}, {36,3,1,128,40,192,45}, {21,4,1,74,54,142,109},
+    {23,4,1,81,54,144,97}, {25,4,1,89,54,147,84}, {27,4,1,96,54,150,72}, {29,4,1,103,54,155,61}, {31,4,1,110,54,162,51}, {33,4,1,117,54,172,43},
+    {35,4,1,124,54,185,38}, {30,5,1,106,67,154,51}, {32,5,1,113,67,162,41}, {34,5,1,120,67,175,34}, {36,5,1,128,67,192,31}, {29,6,1,103,81,147,54},
+    {31,6,1,110,81,153,42}, {33,6,1,117,81,163,32}, {35,6,1,124,81,181,25}, {30,7,1,106,94,144,45}, {32,7,1,113,94,151,32}, {34,7,1,120,94,165,22},
+    {36,7,1,128,94,192,17}, {31,8,1,110,107,140,36}, {33,8,1,117,107,147,23}, {35,8,1,124,107,168,12}, {30,9,1,106,121,131,41}, {32,9,1,113,121,133,28},
+    {34,9,1,120,121,138,14}, {36,9,1,128,121,192,3}, {29,10,1,103,134,125,48}, {31,10,1,110,134,124,34}, {33,10,1,117,134,121,21}, {35,10,1,124,134,109,8},
+    {30,11,1,106,148,118,42}, {32,11,1,113,148,113,29}, {34,11,1,120,148,102,17}, {36,11,1,128,148,64,10}, {29,12,1,103,161,114,51}, {31,12,1,110,161,109,38},
+    {33,12,1,117,161,100,27}, {35,12,1,124,161,80,18}, {30,13,1,106,174,106,48}, {32,13,1,113,174,99,36}, {34,13,1,120,174,85,28}, {36,13,1,128,174,64,24},
+    {29,14,1,103,188,105,57}, {31,14,1,110,188,98,46}, {33,14,1,117,188,88,37}, {35,14,1,124,188,73,32}, {30,15,1,106,201,98,56}, {32,15,1,113,201,90,47},
+    {34,15,1,120,201,78,40}, {36,15,1,128,201,64,38}, {29,16,1,103,215,98,65}, {31,16,1,110,215,91,56}, {33,16,1,117,215,82,49}, {35,16,1,124,215,70,45},
+    {30,17,1,106,228,91,66}, {32,17,1,113,228,84,58}, {34,17,1,120,228,75,53}, {36,17,1,128,228,64,51}, {31,18,1,110,242,86,68}, {33,18,1,117,242,78,62},
+    {35,18,1,124,242,69,59}, {30,19,1,106,255,87,77}, {32,19,1,113,255,80,71}, {34,19,1,120,255,72,66}, {36,19,1,128,255,64,65}, {46,0,2,163,0,225,94},
+    {44,0,2,156,0,221,85}, {42,0,2,149,0,215,77}, {40,0,2,142,0,208,71}, {45,1,2,159,13,225,85}, {43,1,2,152,13,220,75}, {41,1,2,145,13,214,68},
+    {39,1,2,138,13,206,62}, {37,1,2,131,13,197,59}, {44,2,2,156,27,225,75}, {42,2,2,149,27,219,66}, {40,2,2,142,27,212,58}, {38,2,2,135,27,203,53},
+    {43,3,2,152,40,226,65}, {41,3,2,145,40,219,56}, {39,3,2,138,40,210,49}, {37,3,2,131,40,198,45}, {42,4,2,149,54,226,56}, {40,4,2,142,54,218,47},
+    {38,4,2,135,54,206,40}, {43,5,2,152,67,233,57}, {41,5,2,145,67,226,46}, {39,5,2,138,67,216,37}, {37,5,2,131,67,201,32}, {42,6,2,149,81,234,48},
+    {40,6,2,142,81,227,36}, {38,6,2,135,81,213,28}, {45,7,2,159,94,245,64}, {43,7,2,152,94,242,51}, {41,7,2,145,94,237,38}, {39,7,2,138,94,228,27},
+    {38,7,2,135,94,219,22}, {46,8,2,163,107,250,69}, {44,8,2,156,107,248,56}, {42,8,2,149,107,246,42}, {40,8,2,142,107,241,29}, {45,9,2,159,121,254,62},
+    {43,9,2,152,121,253,48}, {46,19,2,163,255,31,94}, {44,19,2,156,255,35,85}, {42,19,2,149,255,41,77}, {40,19,2,142,255,48,71}, {45,18,2,159,242,31,85},
+    {43,18,2,152,242,36,75}, {41,18,2,145,242,42,68}, {39,18,2,138,242,50,62}, {37,18,2,131,242,59,59}, {44,17,2,156,228,31,75}, {42,17,2,149,228,37,66},
+    {40,17,2,142,228,44,58}, {38,17,2,135,228,53,53}, {43,16,2,152,215,30,65}, {41,16,2,145,215,37,56}, {39,16,2,138,215,46,49}, {37,16,2,131,215,58,45},
+    {42,15,2,149,201,30,56}, {40,15,2,142,201,38,47}, {38,15,2,135,201,50,40}, {43,14,2,152,188,23,57}, {41,14,2,145,188,30,46}, {39,14,2,138,188,40,37},
+    {37,14,2,131,188,55,32}, {42,13,2,149,174,22,48}, {40,13,2,142,174,29,36}, {38,13,2,135,174,43,28}, {45,12,2,159,161,11,64}, {43,12,2,152,161,14,51},
+    {41,12,2,145,161,19,38}, {39,12,2,138,161,28,27}, {38,12,2,135,161,37,22}, {46,11,2,163,148,6,69}, {44,11,2,156,148,8,56}, {42,11,2,149,148,10,42},
+    {40,11,2,142,148,15,29}, {45,10,2,159,134,2,62}, {43,10,2,152,134,3,48}, {47,19,2,166,255,29,100}, {49,19,2,174,255,26,110}, {51,19,2,181,255,23,122},
+    {53,19,2,188,255,21,133}, {48,18,2,170,242,25,101}, {50,18,2,177,242,22,112}, {52,18,2,184,242,20,124}, {54,18,2,191,242,18,136}, {56,18,2,198,242,16,149},
+    {49,17,2,174,228,21,103}, {51,17,2,181,228,19,115}, {53,17,2,188,228,17,127}, {55,17,2,195,228,15,140}, {50,16,2,177,215,18,106}, {52,16,2,184,215,16,118},
+    {54,16,2,191,215,14,131}, {56,16,2,198,215,13,144}, {51,15,2,181,201,14,109}, {53,15,2,188,201,13,122}, {55,15,2,195,201,11,135}, {50,14,2,177,188,13,101},
+    {52,14,2,184,188,11,114}, {54,14,2,191,188,10,127}, {56,14,2,198,188,9,140}, {51,13,2,181,174,9,105}, {53,13,2,188,174,8,119}, {55,13,2,195,174,7,132},
+    {48,12,2,170,161,8,84}, {50,12,2,177,161,7,97}, {52,12,2,184,161,6,111}, {54,12,2,191,161,6,124}, {56,12,2,198,161,5,138}, {47,11,2,166,148,6,76},
+    {49,11,2,174,148,5,90}, {51,11,2,181,148,4,103}, {53,11,2,188,148,4,117}, {48,10,2,170,134,2,82}, {50,10,2,177,134,1,96}, {47,0,2,166,0,227,100},
+    {49,0,2,174,0,230,110}, {51,0,2,181,0,233,122}, {53,0,2,188,0,235,133}, {48,1,2,170,13,231,101}, {50,1,2,177,13,234,112}, {52,1,2,184,13,236,124},
+    {54,1,2,191,13,238,136}, {56,1,2,198,13,240,149}, {49,2,2,174,27,235,103}, {51,2,2,181,27,237,115}, {53,2,2,188,27,239,127}, {55,2,2,195,27,241,140},
+    {50,3,2,177,40,238,106}, {52,3,2,184,40,240,118}, {54,3,2,191,40,242,131}, {56,3,2,198,40,243,144}, {51,4,2,181,54,242,109}, {53,4,2,188,54,243,122},
+    {55,4,2,195,54,245,135}, {50,5,2,177,67,243,101}, {52,5,2,184,67,245,114}, {54,5,2,191,67,246,127}, {56,5,2,198,67,247,140}, {51,6,2,181,81,247,105},
+    {53,6,2,188,81,248,119}, {55,6,2,195,81,249,132}, {48,7,2,170,94,248,84}, {50,7,2,177,94,249,97}, {52,7,2,184,94,250,111}, {54,7,2,191,94,250,124},
+    {56,7,2,198,94,251,138}, {47,8,2,166,107,250,76}, {49,8,2,174,107,251,90}, {51,8,2,181,107,252,103}, {53,8,2,188,107,252,117}, {48,9,2,170,121,254,82},
+    {50,9,2,177,121,255,96}, {65,0,3,230,0,243,209}, {67,0,3,237,0,244,222}, {69,0,3,244,0,245,235}, {71,0,3,251,0,245,248}, {62,1,3,220,13,243,187},
+    {64,1,3,227,13,244,200}, {66,1,3,234,13,245,214}, {68,1,3,241,13,245,227}, {70,1,3,248,13,246,240}, {72,1,3,255,13,247,253}, {59,2,3,209,27,243,166},
+    {61,2,3,216,27,244,179}, {63,2,3,223,27,245,192}, {65,2,3,230,27,246,205}, {67,2,3,237,27,246,218}, {69,2,3,244,27,247,232}, {71,2,3,251,27,247,245},
+    {58,3,3,205,40,244,157}, {60,3,3,213,40,245,170}, {62,3,3,220,40,246,184}, {64,3,3,227,40,247,197}, {66,3,3,234,40,247,210}, {68,3,3,241,40,248,224},
+    {70,3,3,248,40,248,237}, {72,3,3,255,40,249,251}, {57,4,3,202,54,246,149}, {59,4,3,209,54,246,162}, {61,4,3,216,54,247,175}, {63,4,3,223,54,248,189},
+    {65,4,3,230,54,248,202}, {67,4,3,237,54,249,216}, {69,4,3,244,54,249,229}, {71,4,3,251,54,250,243}, {66,5,3,234,67,250,208}, {68,5,3,241,67,250,221},
+    {70,5,3,248,67,251,235}, {72,5,3,255,67,251,248}, {65,6,3,230,81,251,200}, {67,6,3,237,81,251,214}, {69,6,3,244,81,252,227}, {71,6,3,251,81,252,241},
+    {66,7,3,234,94,253,206}, {68,7,3,241,94,253,220}, {70,7,3,248,94,253,233}, {72,7,3,255,94,253,247}, {67,8,3,237,107,254,213}, {69,8,3,244,107,254,226},
+    {71,8,3,251,107,254,240}, {66,9,3,234,121,255,205}, {68,9,3,241,121,255,219}, {70,9,3,248,121,255,233}, {72,9,3,255,121,255,247}, {65,10,3,230,134,1,199},
+    {67,10,3,237,134,1,212}, {69,10,3,244,134,1,226}, {71,10,3,251,134,1,240}, {66,11,3,234,148,2,206}, {68,11,3,241,148,2,219}, {70,11,3,248,148,2,233},
+    {72,11,3,255,148,2,247}, {65,12,3,230,161,4,199}, {67,12,3,237,161,3,213}, {69,12,3,244,161,3,227}, {71,12,3,251,161,3,240}, {66,13,3,234,174,5,207},
+    {68,13,3,241,174,4,220}, {70,13,3,248,174,4,234}, {72,13,3,255,174,4,248}, {65,14,3,230,188,6,201}, {67,14,3,237,188,6,215}, {69,14,3,244,188,6,228},
+    {71,14,3,251,188,5,242}, {66,15,3,234,201,7,209}, {68,15,3,241,201,7,222}, {70,15,3,248,201,7,236}, {72,15,3,255,201,6,249}, {65,16,3,230,215,9,204},
+    {67,16,3,237,215,8,217}, {69,16,3,244,215,8,230}, {71,16,3,251,215,7,244}, {66,17,3,234,228,10,212}, {68,17,3,241,228,9,225}, {70,17,3,248,228,9,238},
+    {72,17,3,255,228,8,252}, {67,18,3,237,242,11,220}, {69,18,3,244,242,10,233}, {71,18,3,251,242,10,247}, {66,19,3,234,255,12,216}, {68,19,3,241,255,12,229},
+    {70,19,3,248,255,11,242}, {72,19,3,255,255,11,255}
+  };
+}
+
+// The NEO PIXEL 12-LED ring used for testing.
+// The rows/columns/digits are small pieces of the ring.
+namespace TestRingLayout {
+  constexpr uint16_t PixelCount = 12;
+
+  constexpr uint16_t RowOffsets[] = {
+    0,1,3,5,7,9,11,12
+  };
+  constexpr uint16_t RowPixels[] = {
+    3,
+    2,4,
+    1,5,
+    0,6,
+    11,7,
+    10,8,
+    9
+  };
+
+  constexpr uint16_t ColumnOffsets[] = {
+    0,1,3,5,7,9,11,12
+  };
+  constexpr uint16_t ColumnPixels[] = {
+    0,
+    1,11,
+    2,10,
+    3,9,
+    4,8,
+    5,7,
+    6
+  };
+
+  constexpr uint16_t DigitOffsets[] = {
+    0,3,6,9,12
+  };
+  constexpr uint16_t DigitPixels[] = {
+    0,1,11,
+    2,3,4,
+    5,6,7,
+    8,9,10
+  };
+
+  constexpr PixelBlockMap Rows = { RowOffsets, RowPixels, PIXEL_LAYOUTS_BLOCKCOUNT(RowOffsets), true };
+  constexpr PixelBlockMap Columns = { ColumnOffsets, ColumnPixels, PIXEL_LAYOUTS_BLOCKCOUNT(ColumnOffsets), true };
+  constexpr PixelBlockMap Digits = { DigitOffsets, DigitPixels, PIXEL_LAYOUTS_BLOCKCOUNT(DigitOffsets), true };
+
+  // Generated by host/GeneratePixelInfo from the block maps above. Don't edit by hand.
+  // Each entry is { column, row, digit, x, y, angle, radius }.
+  constexpr PixelInfo Pixels[] = {
+    {0,3,0,0,128,128,180}, {1,2,0,43,85,147,134}, {2,1,1,85,43,173,134}, {3,0,1,128,0,192,180}, {4,1,1,170,43,211,134}, {5,2,2,213,85,237,134},
+    {6,3,2,255,128,0,180}, {5,4,2,213,170,19,134}, {4,5,3,170,213,45,134}, {3,6,3,128,255,64,180}, {2,5,3,85,213,83,134}, {1,4,0,43,170,109,134}
+  };
+}
+
+#endif
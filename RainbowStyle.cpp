@@ -2,6 +2,7 @@
 #include "Arduino.h"
 #include "RainbowStyle.h"
 #include "PixelBuffer.h"
+#include "HueWheel.h"
 
 RainbowStyle::RainbowStyle(String name, PixelBuffer* pixelBuffer) : LightStyle(name, pixelBuffer) {
   m_nextUpdate = 0;
@@ -9,14 +10,14 @@ RainbowStyle::RainbowStyle(String name, PixelBuffer* pixelBuffer) : LightStyle(n
 }
 
 void RainbowStyle::update() {
-  if (millis() < m_nextUpdate) {
+  if (!m_isFreeRunning && millis() < m_nextUpdate) {
     return;
   }
 
-  uint32_t newColor = Adafruit_NeoPixel::ColorHSV(m_currentHue);
+  uint32_t newColor = HueWheel::getColor(m_currentHue);
   shiftColorUsingPattern(newColor);
   incrementHue();
-  m_nextUpdate = millis() + getIterationDelay();
+  m_nextUpdate = millis() + m_iterationDelay;
 }
 
 void RainbowStyle::reset()
@@ -26,39 +27,68 @@ void RainbowStyle::reset()
     // The only patterns with this many blocks are the line patterns.
     // Instead of shifting tons of times, just set the pixels directly.
     for (int i = numBlocks - 1; i >= 0; i--) {
-      m_pixelBuffer->setPixel(i, Adafruit_NeoPixel::ColorHSV(m_currentHue));
+      m_pixelBuffer->setPixel(i, HueWheel::getColor(m_currentHue));
       incrementHue();
     }
 
     return;
   }
 
-  for (int i = 0; i < numBlocks - 1; i++) {
-    shiftColorUsingPattern(Adafruit_NeoPixel::ColorHSV(m_currentHue));
+  if (!canSetBlocksUsingPattern()) {
+    for (int i = 0; i < numBlocks - 1; i++) {
+      shiftColorUsingPattern(HueWheel::getColor(m_currentHue));
+      incrementHue();
+    }
+
+    return;
+  }
+
+  // Give each block the color it would have after shifting in numBlocks - 1 hues:
+  // the last hue goes in block 0, and the last block gets the color block 0 had.
+  if (numBlocks > 1) {
+    setBlockColorUsingPattern(numBlocks - 1, getBlockColorUsingPattern(0));
+  }
+
+  for (int i = numBlocks - 2; i >= 0; i--) {
+    setBlockColorUsingPattern(i, HueWheel::getColor(m_currentHue));
     incrementHue();
   }
 }
 
-int RainbowStyle::getIterationDelay() {
+void RainbowStyle::setSpeed(byte speed) {
+  LightStyle::setSpeed(speed);
+  m_iterationDelay = getIterationDelay(speed);
+}
+
+void RainbowStyle::setStep(byte step) {
+  LightStyle::setStep(step);
+  m_hueIncrement = getHueIncrement(step);
+}
+
+int RainbowStyle::getIterationDelay(byte speed) {
   // Convert "speed" to a delay.
-  // Speed ranges from 1 to 100.
+  // Speed ranges from 1 to 100, and maps linearly from the max delay down to the min delay.
+  // Integer math only -- this gives the same results as the linear mapping in floating point.
   int minDelay = 5;
   int maxDelay = 500;
-  double m = (maxDelay - minDelay)/-99.0;
-  double b = maxDelay - m;
-  int delay = m_speed*m + b;
-  return delay;
+  int minSpeed = 1;
+  int maxSpeed = 100;
+  return maxDelay - (speed - minSpeed) * (maxDelay - minDelay) / (maxSpeed - minSpeed);
 }
 
-void RainbowStyle::incrementHue() {
+int RainbowStyle::getHueIncrement(byte step) {
   // Convert "step" to an increment.
+  // Step ranges from 1 to 100, and maps linearly from the min increment up to the max increment.
   int maxInc = 1000;
   int minInc = 5;
   int maxStep = 100;
   int minStep = 1;
-  double m = (double)(maxInc - minInc)/(maxStep - minStep);
-  double b = minInc - m;
-  int inc = m_step*m + b;
-  m_currentHue += inc;
+  // The floating-point mapping lands just under the max increment at the top step,
+  // so subtract one before dividing to round that exact multiple down the same way.
+  return minInc + ((step - minStep) * (maxInc - minInc) - 1) / (maxStep - minStep);
+}
+
+void RainbowStyle::incrementHue() {
+  m_currentHue += m_hueIncrement;
 }
 
@@ -10,15 +10,22 @@ class RainbowStyle : public LightStyle {
   public:
     RainbowStyle(String name, PixelBuffer* pixelBuffer);
     
+    void setSpeed(byte speed);
+    void setStep(byte step);
     void reset();
     void update();
 
+    // The speed/step mappings, shared with the spatially-rendered version of the style.
+    static int getIterationDelay(byte speed);
+    static int getHueIncrement(byte step);
+
   private:
-    int getIterationDelay();
     void incrementHue();
 
     uint16_t m_currentHue;
     unsigned long m_nextUpdate;
+    int m_iterationDelay{0};
+    int m_hueIncrement{0};
 };
 
 #endif
\ No newline at end of file
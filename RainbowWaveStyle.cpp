@@ -0,0 +1,31 @@
+#include "Arduino.h"
+#include "RainbowWaveStyle.h"
+#include "RainbowStyle.h"
+#include "HueWheel.h"
+#include "PixelBuffer.h"
+
+RainbowWaveStyle::RainbowWaveStyle(String name, PixelBuffer* pixelBuffer) : SpatialStyle(name, pixelBuffer) {
+}
+
+void RainbowWaveStyle::setSpeed(byte speed) {
+  LightStyle::setSpeed(speed);
+  m_tickPeriod = RainbowStyle::getIterationDelay(speed);
+}
+
+void RainbowWaveStyle::setStep(byte step) {
+  LightStyle::setStep(step);
+  m_hueIncrement = RainbowStyle::getHueIncrement(step);
+}
+
+unsigned long RainbowWaveStyle::getTickPeriod() {
+  return m_tickPeriod;
+}
+
+uint32_t RainbowWaveStyle::getPixelColor(unsigned int pixel, uint16_t position, unsigned long ticks) {
+  // RainbowStyle adds one hue increment per update, so a pixel "position" blocks from
+  // the start of the pattern shows the hue from that many updates ago. Positions between
+  // blocks get the hue in between.
+  // The hue wraps around, so the unsigned math doesn't need to worry about ticks < position.
+  uint32_t distance = ticks * PositionScale - position;
+  return HueWheel::getColor(distance * m_hueIncrement / PositionScale);
+}
@@ -0,0 +1,25 @@
+#include "SpatialStyle.h"
+#include "Arduino.h"
+#include "PixelBuffer.h"
+
+#ifndef RAINBOW_WAVE_STYLE_H
+#define RAINBOW_WAVE_STYLE_H
+
+// The rainbow style, drawn spatially. Speed and step mean the same as for RainbowStyle.
+class RainbowWaveStyle : public SpatialStyle {
+  public:
+    RainbowWaveStyle(String name, PixelBuffer* pixelBuffer);
+
+    void setSpeed(byte speed);
+    void setStep(byte step);
+
+  protected:
+    unsigned long getTickPeriod();
+    uint32_t getPixelColor(unsigned int pixel, uint16_t position, unsigned long ticks);
+
+  private:
+    unsigned long m_tickPeriod{500};
+    uint16_t m_hueIncrement{5};
+};
+
+#endif
@@ -0,0 +1,43 @@
+#include <atomic>
+#include "Arduino.h"
+#include "SettingsQueue.h"
+
+static_assert((SETTINGS_QUEUE_SIZE & (SETTINGS_QUEUE_SIZE - 1)) == 0, "The queue size must be a power of 2.");
+static_assert(SETTINGS_QUEUE_SIZE < 256, "The queue indices must fit in a byte.");
+
+bool SettingsQueue::push(SettingChange change) {
+  return push(&change, 1);
+}
+
+bool SettingsQueue::push(const SettingChange* changes, uint8_t count) {
+  uint8_t tail = m_tail.load(std::memory_order_relaxed);
+  uint8_t head = m_head.load(std::memory_order_acquire);
+  if ((uint8_t)(tail - head) + count > SETTINGS_QUEUE_SIZE) {
+    m_droppedCount += count;
+    return false;
+  }
+
+  // Write the entries before publishing the new tail, so the consumer never sees a half-written entry.
+  for (uint8_t i = 0; i < count; i++) {
+    m_changes[(uint8_t)(tail + i) % SETTINGS_QUEUE_SIZE] = changes[i];
+  }
+
+  m_tail.store(tail + count, std::memory_order_release);
+  return true;
+}
+
+bool SettingsQueue::pop(SettingChange* change) {
+  uint8_t head = m_head.load(std::memory_order_relaxed);
+  uint8_t tail = m_tail.load(std::memory_order_acquire);
+  if (head == tail) {
+    return false;
+  }
+
+  *change = m_changes[head % SETTINGS_QUEUE_SIZE];
+  m_head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+unsigned long SettingsQueue::getDroppedCount() {
+  return m_droppedCount;
+}
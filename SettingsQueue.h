@@ -0,0 +1,52 @@
+#include <atomic>
+#include "Arduino.h"
+
+#ifndef SETTINGS_QUEUE_H
+#define SETTINGS_QUEUE_H
+
+// The number of setting changes that can be waiting at once. Must be a power of 2.
+#define SETTINGS_QUEUE_SIZE 32
+
+// The settings that can be written over BLE.
+enum SettingType : uint8_t {
+  SettingBrightness,
+  SettingStyle,
+  SettingSpeed,
+  SettingStep,
+  SettingPattern
+};
+
+struct SettingChange {
+  SettingType type;
+  byte value;
+};
+
+// A lock-free queue of setting changes, for one producer (the BLE event handlers)
+// and one consumer (the main loop).
+class SettingsQueue {
+  public:
+    // Adds a change to the end of the queue.
+    // Returns false (and drops the change) if the queue is full.
+    bool push(SettingChange change);
+
+    // Adds several changes to the end of the queue. The consumer sees either all of them or none.
+    // Returns false (and drops all the changes) if there isn't room for all of them.
+    bool push(const SettingChange* changes, uint8_t count);
+
+    // Takes the oldest change off the queue. Returns false if the queue is empty.
+    bool pop(SettingChange* change);
+
+    // Gets the number of changes dropped because the queue was full.
+    unsigned long getDroppedCount();
+
+  private:
+    SettingChange m_changes[SETTINGS_QUEUE_SIZE];
+
+    // The head is only written by the consumer, and the tail only by the producer.
+    // They count up forever; the slot is the count modulo the queue size.
+    std::atomic<uint8_t> m_head{0};
+    std::atomic<uint8_t> m_tail{0};
+    unsigned long m_droppedCount{0};
+};
+
+#endif
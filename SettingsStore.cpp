@@ -0,0 +1,296 @@
+#include "Arduino.h"
+#include "SettingsStore.h"
+#include "Crc32.h"
+
+// "SSL1" - the magic number at the start of a valid sector.
+#define SETTINGS_STORE_MAGIC 0x314C5353
+#define SETTINGS_STORE_HEADERSIZE 12
+#define SETTINGS_STORE_RECORDMARKER 0xA5
+
+bool SettingsStore::initialize() {
+  if (m_flash.init() != 0) {
+    Serial.println("Unable to open the flash for the stored settings.");
+    return false;
+  }
+
+  // Use the last two sectors of the flash, well above the sketch.
+  uint32_t flashEnd = m_flash.get_flash_start() + m_flash.get_flash_size();
+  m_sectorSize = m_flash.get_sector_size(flashEnd - 1);
+  m_sectorAddress[1] = flashEnd - m_sectorSize;
+  m_sectorAddress[0] = m_sectorAddress[1] - m_sectorSize;
+  m_isInitialized = true;
+
+  uint32_t sequence[2];
+  bool isValid[2];
+  for (int i = 0; i < 2; i++) {
+    isValid[i] = readHeader(i, &sequence[i]);
+  }
+
+  if (isValid[0] && isValid[1]) {
+    // Both are valid if the power went out before the old one was erased. The newer one wins.
+    m_activeSector = (int32_t)(sequence[1] - sequence[0]) > 0 ? 1 : 0;
+  } else if (isValid[0] || isValid[1]) {
+    m_activeSector = isValid[0] ? 0 : 1;
+  } else {
+    Serial.println("No stored settings found.");
+    return false;
+  }
+
+  m_activeSequence = sequence[m_activeSector];
+  readRecords(m_activeSector);
+  return m_hasScene || m_manualStylesLength > 0;
+}
+
+void SettingsStore::setSaveDelay(unsigned long msec) {
+  m_saveDelay = msec;
+}
+
+bool SettingsStore::getScene(SceneSettings* scene) {
+  if (!m_hasScene) {
+    return false;
+  }
+
+  *scene = m_scene;
+  return true;
+}
+
+void SettingsStore::setScene(const SceneSettings& scene) {
+  if (m_hasScene && memcmp(&scene, &m_scene, sizeof(SceneSettings)) == 0) {
+    return;
+  }
+
+  m_scene = scene;
+  m_hasScene = true;
+  m_isScenePending = true;
+  m_lastChange = millis();
+}
+
+bool SettingsStore::getManualStyles(std::vector<ManualSelection>* definitions, int buttonCount) {
+  // The record is the button count, then for each button the number of styles followed by
+  // style, brightness, pattern, step and speed for each one.
+  if (m_manualStylesLength == 0 || m_manualStyles[0] != buttonCount) {
+    return false;
+  }
+
+  // Check the whole record before changing any of the definitions.
+  uint16_t offset = 1;
+  for (int i = 0; i < buttonCount; i++) {
+    if (offset >= m_manualStylesLength) {
+      return false;
+    }
+
+    uint8_t count = m_manualStyles[offset];
+    if (count == 0) {
+      return false;
+    }
+
+    offset += 1 + count * 5;
+  }
+
+  if (offset != m_manualStylesLength) {
+    return false;
+  }
+
+  offset = 1;
+  for (int i = 0; i < buttonCount; i++) {
+    uint8_t count = m_manualStyles[offset++];
+    definitions[i].clear();
+    for (int j = 0; j < count; j++) {
+      const uint8_t* selection = m_manualStyles + offset;
+      definitions[i].push_back(ManualSelection(selection[0], selection[1], selection[2], selection[3], selection[4]));
+      offset += 5;
+    }
+  }
+
+  return true;
+}
+
+void SettingsStore::setManualStyles(const std::vector<ManualSelection>* definitions, int buttonCount) {
+  uint8_t record[SETTINGS_STORE_MAXPAYLOAD];
+  uint16_t length = 0;
+  record[length++] = buttonCount;
+  for (int i = 0; i < buttonCount; i++) {
+    if (length + 1 + definitions[i].size() * 5 > SETTINGS_STORE_MAXPAYLOAD) {
+      Serial.println("Too many manual styles to store.");
+      return;
+    }
+
+    record[length++] = definitions[i].size();
+    for (const ManualSelection& selection : definitions[i]) {
+      record[length++] = selection.StyleIndex;
+      record[length++] = selection.Brightness;
+      record[length++] = selection.PatternIndex;
+      record[length++] = selection.Step;
+      record[length++] = selection.Speed;
+    }
+  }
+
+  if (length == m_manualStylesLength && memcmp(record, m_manualStyles, length) == 0) {
+    return;
+  }
+
+  memcpy(m_manualStyles, record, length);
+  m_manualStylesLength = length;
+  m_isManualStylesPending = true;
+  m_lastChange = millis();
+}
+
+void SettingsStore::update() {
+  if (!m_isInitialized || !(m_isScenePending || m_isManualStylesPending)) {
+    return;
+  }
+
+  if (millis() - m_lastChange < m_saveDelay) {
+    return;
+  }
+
+  uint32_t neededSize = 0;
+  if (m_isScenePending) {
+    neededSize += getRecordSize(sizeof(SceneSettings));
+  }
+
+  if (m_isManualStylesPending) {
+    neededSize += getRecordSize(m_manualStylesLength);
+  }
+
+  bool isSaved;
+  if (m_activeSector < 0 || m_needsNewSector || m_writeOffset + neededSize > m_sectorSize) {
+    // The new sector gets the latest of everything, including these changes.
+    isSaved = moveToNewSector();
+  } else {
+    isSaved = (!m_isScenePending || appendRecord(m_activeSector, &m_writeOffset, RecordScene, (const uint8_t*)&m_scene, sizeof(SceneSettings)))
+      && (!m_isManualStylesPending || appendRecord(m_activeSector, &m_writeOffset, RecordManualStyles, m_manualStyles, m_manualStylesLength));
+  }
+
+  if (isSaved) {
+    m_isScenePending = false;
+    m_isManualStylesPending = false;
+  } else {
+    // Whatever was partly written can't be trusted. Start over in the other sector after another delay.
+    Serial.println("Unable to save the settings.");
+    m_needsNewSector = true;
+    m_lastChange = millis();
+  }
+}
+
+bool SettingsStore::readHeader(int sector, uint32_t* sequence) {
+  uint32_t header[SETTINGS_STORE_HEADERSIZE / 4];
+  if (m_flash.read(header, m_sectorAddress[sector], SETTINGS_STORE_HEADERSIZE) != 0) {
+    return false;
+  }
+
+  *sequence = header[1];
+  return header[0] == SETTINGS_STORE_MAGIC && header[2] == Crc32::compute((const uint8_t*)header, 8);
+}
+
+void SettingsStore::readRecords(int sector) {
+  uint32_t record[(SETTINGS_STORE_MAXPAYLOAD + 8) / 4];
+  uint32_t offset = SETTINGS_STORE_HEADERSIZE;
+  while (offset + 4 <= m_sectorSize) {
+    uint32_t address = m_sectorAddress[sector] + offset;
+    if (m_flash.read(record, address, 4) != 0) {
+      m_needsNewSector = true;
+      break;
+    }
+
+    if (record[0] == 0xFFFFFFFF) {
+      // Still erased - this is the end of the log.
+      break;
+    }
+
+    uint8_t marker = record[0] & 0xFF;
+    uint8_t type = (record[0] >> 8) & 0xFF;
+    uint16_t length = record[0] >> 16;
+    uint32_t size = getRecordSize(length);
+    bool isValid = marker == SETTINGS_STORE_RECORDMARKER && length <= SETTINGS_STORE_MAXPAYLOAD && offset + size <= m_sectorSize;
+    if (isValid) {
+      isValid = m_flash.read(record, address, size) == 0
+        && record[size / 4 - 1] == Crc32::compute((const uint8_t*)record, 4 + length);
+    }
+
+    if (!isValid) {
+      // Probably a write cut off by a power loss. Nothing after it can be trusted either.
+      Serial.println("Ignoring a damaged settings record.");
+      m_needsNewSector = true;
+      break;
+    }
+
+    applyRecord(type, (const uint8_t*)record + 4, length);
+    offset += size;
+  }
+
+  m_writeOffset = offset;
+}
+
+void SettingsStore::applyRecord(uint8_t type, const uint8_t* payload, uint16_t length) {
+  // Later records replace earlier ones. Unknown types are skipped.
+  switch (type) {
+    case RecordScene:
+      if (length == sizeof(SceneSettings)) {
+        memcpy(&m_scene, payload, length);
+        m_hasScene = true;
+      }
+      break;
+    case RecordManualStyles:
+      memcpy(m_manualStyles, payload, length);
+      m_manualStylesLength = length;
+      break;
+  }
+}
+
+bool SettingsStore::appendRecord(int sector, uint32_t* offset, uint8_t type, const uint8_t* payload, uint16_t length) {
+  // The record is a header word (marker, type, length), the payload padded to a whole word,
+  // then the CRC of the header and payload. The flash is programmed a word at a time.
+  uint32_t record[(SETTINGS_STORE_MAXPAYLOAD + 8) / 4];
+  uint32_t size = getRecordSize(length);
+  memset(record, 0xFF, size);
+  record[0] = SETTINGS_STORE_RECORDMARKER | (type << 8) | ((uint32_t)length << 16);
+  memcpy((uint8_t*)record + 4, payload, length);
+  record[size / 4 - 1] = Crc32::compute((const uint8_t*)record, 4 + length);
+
+  if (m_flash.program(record, m_sectorAddress[sector] + *offset, size) != 0) {
+    return false;
+  }
+
+  *offset += size;
+  return true;
+}
+
+bool SettingsStore::moveToNewSector() {
+  int sector = m_activeSector == 0 ? 1 : 0;
+  uint32_t sequence = m_activeSequence + 1;
+  Serial.print("Moving the stored settings to sector ");
+  Serial.println(sector);
+
+  if (m_flash.erase(m_sectorAddress[sector], m_sectorSize) != 0) {
+    return false;
+  }
+
+  uint32_t offset = SETTINGS_STORE_HEADERSIZE;
+  if (m_hasScene && !appendRecord(sector, &offset, RecordScene, (const uint8_t*)&m_scene, sizeof(SceneSettings))) {
+    return false;
+  }
+
+  if (m_manualStylesLength > 0 && !appendRecord(sector, &offset, RecordManualStyles, m_manualStyles, m_manualStylesLength)) {
+    return false;
+  }
+
+  // The header goes last, so the sector isn't used until everything else is in it.
+  uint32_t header[SETTINGS_STORE_HEADERSIZE / 4];
+  header[0] = SETTINGS_STORE_MAGIC;
+  header[1] = sequence;
+  header[2] = Crc32::compute((const uint8_t*)header, 8);
+  if (m_flash.program(header, m_sectorAddress[sector], SETTINGS_STORE_HEADERSIZE) != 0) {
+    return false;
+  }
+
+  m_activeSector = sector;
+  m_activeSequence = sequence;
+  m_writeOffset = offset;
+  m_needsNewSector = false;
+  return true;
+}
+
+uint32_t SettingsStore::getRecordSize(uint16_t length) {
+  return 4 + ((length + 3) & ~3) + 4;
+}
@@ -0,0 +1,97 @@
+#include <vector>
+#include "Arduino.h"
+#include "FlashIAP.h"
+#include "ManualSelection.h"
+
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+// The largest record that can be stored.
+#define SETTINGS_STORE_MAXPAYLOAD 128
+
+// The look of the sign, in the same order as the BLE scene characteristic.
+struct SceneSettings {
+  byte style;
+  byte pattern;
+  byte speed;
+  byte step;
+  byte brightness;
+};
+
+// Keeps the last scene and the manual style definitions in flash, so they survive a power cycle.
+//
+// The settings are an append-only log in the last two sectors of the flash.
+// Each change adds a record to the end of the active sector; when it fills up, the latest
+// records are copied to the other sector, which becomes the active one. So each sector is
+// only erased once every few hundred changes, and the two take turns.
+//
+// Each sector starts with a header (magic number, sequence number, CRC) and each record
+// has its own CRC. A record that was only partly written when the power went out fails its
+// CRC and is ignored, along with anything after it, and the next write moves to a fresh sector.
+// The header of a new sector is written last, so the old sector stays in use until the new one
+// is complete.
+class SettingsStore {
+  public:
+    // Finds the newest sector and reads the latest records from it.
+    // Returns false if there are no stored settings (or the flash couldn't be read).
+    bool initialize();
+
+    // Sets the time (in msec) a change has to stay put before it's written,
+    // so sliding a setting in the app doesn't write every step along the way.
+    void setSaveDelay(unsigned long msec);
+
+    // Gets the stored scene. Returns false if there isn't one.
+    bool getScene(SceneSettings* scene);
+
+    // Saves the scene, if it's different from the stored one.
+    // The write happens in update(), after the save delay.
+    void setScene(const SceneSettings& scene);
+
+    // Replaces the definitions for each button with the stored ones.
+    // Returns false (and leaves the definitions alone) if none are stored for this many buttons.
+    bool getManualStyles(std::vector<ManualSelection>* definitions, int buttonCount);
+
+    // Saves the definitions for each button, if they're different from the stored ones.
+    void setManualStyles(const std::vector<ManualSelection>* definitions, int buttonCount);
+
+    // Writes any changes that have been waiting for the save delay.
+    // Moving to the other sector erases it, which stalls the CPU for up to ~90 msec.
+    void update();
+
+  private:
+    enum RecordType : uint8_t {
+      RecordScene = 1,
+      RecordManualStyles = 2
+    };
+
+    mbed::FlashIAP m_flash;
+    bool m_isInitialized{false};
+    uint32_t m_sectorAddress[2];
+    uint32_t m_sectorSize{0};
+
+    // The sector being appended to (-1 if neither is valid), and where the next record goes.
+    int m_activeSector{-1};
+    uint32_t m_activeSequence{0};
+    uint32_t m_writeOffset{0};
+    bool m_needsNewSector{false};
+
+    // The latest value of each record, and whether it still has to be written.
+    SceneSettings m_scene;
+    bool m_hasScene{false};
+    bool m_isScenePending{false};
+    uint8_t m_manualStyles[SETTINGS_STORE_MAXPAYLOAD];
+    uint16_t m_manualStylesLength{0};
+    bool m_isManualStylesPending{false};
+
+    unsigned long m_saveDelay{0};
+    unsigned long m_lastChange{0};
+
+    bool readHeader(int sector, uint32_t* sequence);
+    void readRecords(int sector);
+    void applyRecord(uint8_t type, const uint8_t* payload, uint16_t length);
+    bool appendRecord(int sector, uint32_t* offset, uint8_t type, const uint8_t* payload, uint16_t length);
+    bool moveToNewSector();
+    static uint32_t getRecordSize(uint16_t length);
+};
+
+#endif
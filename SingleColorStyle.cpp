@@ -18,3 +18,8 @@ void SingleColorStyle::reset()
     m_pixelBuffer->setPixel(i, m_color);
   }
 }
+
+StyleCapabilities SingleColorStyle::getCapabilities() {
+  // A single color ignores the pattern, speed, and step.
+  return StyleCapabilities{ 1, 0, 0, 0, 0 };
+}
@@ -11,6 +11,7 @@ class SingleColorStyle : public LightStyle {
     
     void reset();
     void update();
+    StyleCapabilities getCapabilities();
 
   private:
     uint32_t m_color;
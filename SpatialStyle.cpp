@@ -0,0 +1,114 @@
+#include "Arduino.h"
+#include "SpatialStyle.h"
+#include "PixelBuffer.h"
+
+SpatialStyle::SpatialStyle(String name, PixelBuffer* pixelBuffer) : LightStyle(name, pixelBuffer) {
+}
+
+void SpatialStyle::reset() {
+  m_ticks = 0;
+  m_elapsed = 0;
+  m_lastUpdate = millis();
+  m_needsRender = true;
+}
+
+void SpatialStyle::update() {
+  unsigned long now = millis();
+  m_elapsed += now - m_lastUpdate;
+  m_lastUpdate = now;
+
+  // Carry the leftover time into the next tick, so a speed change
+  // only changes how fast the clock runs from here on.
+  unsigned long tickPeriod = getTickPeriod();
+  if (m_isFreeRunning) {
+    m_ticks++;
+    m_needsRender = true;
+  } else if (m_elapsed >= tickPeriod) {
+    m_ticks += m_elapsed / tickPeriod;
+    m_elapsed %= tickPeriod;
+    m_needsRender = true;
+  }
+
+  if (m_positionsPattern != m_pattern) {
+    buildPatternPositions();
+    m_needsRender = true;
+  }
+
+  if (!m_needsRender) {
+    return;
+  }
+
+  for (unsigned int i = 0; i < m_pixelBuffer->getPixelCount(); i++) {
+    uint16_t position = m_patternPositions[i];
+    if (position != NoPosition) {
+      m_pixelBuffer->setPixel(i, getPixelColor(i, position, m_ticks));
+    }
+  }
+
+  m_needsRender = false;
+}
+
+StyleCapabilities SpatialStyle::getCapabilities() {
+  return StyleCapabilities{ (uint16_t)((1 << knownPatterns.size()) - 1), 1, 100, 1, 100 };
+}
+
+void SpatialStyle::buildPatternPositions() {
+  // These match the directions used by LightStyle::shiftColorUsingPattern, but come from
+  // where each pixel actually is instead of the block it's in.
+  // x and y run from 0 to 255 across the sign, so scale them back to blocks.
+  uint32_t columnSpan = (m_pixelBuffer->getColumnCount() - 1) * PositionScale;
+  uint32_t rowSpan = (m_pixelBuffer->getRowCount() - 1) * PositionScale;
+
+  // A radius of 255 is the corner, measured the same way.
+  float centerX = (m_pixelBuffer->getColumnCount() - 1) / 2.0f;
+  float centerY = (m_pixelBuffer->getRowCount() - 1) / 2.0f;
+  uint32_t radiusSpan = sqrtf(centerX * centerX + centerY * centerY) * PositionScale + 0.5f;
+
+  for (unsigned int i = 0; i < m_pixelBuffer->getPixelCount(); i++) {
+    PixelInfo info = m_pixelBuffer->getPixelInfo(i);
+    uint8_t block;
+    uint16_t position;
+    switch (m_pattern) {
+      case 1: // Right
+        block = info.column;
+        position = (info.x * columnSpan + 127) / 255;
+        break;
+      case 2: // Left
+        block = info.column;
+        position = ((255 - info.x) * columnSpan + 127) / 255;
+        break;
+      case 3: // Up
+        block = info.row;
+        position = ((255 - info.y) * rowSpan + 127) / 255;
+        break;
+      case 4: // Down
+        block = info.row;
+        position = (info.y * rowSpan + 127) / 255;
+        break;
+      case 5: // Digit
+        block = info.digit;
+        position = block * PositionScale;
+        break;
+      case 6: // "Random"
+        block = 0;
+        position = i * PositionScale;
+        break;
+      case 7: // Ripple, out from the center
+        block = 0;
+        position = (info.radius * radiusSpan + 127) / 255;
+        break;
+      case 8: // Spin, clockwise around the center
+        block = 0;
+        position = info.angle;
+        break;
+      default:
+        // Default to Solid (ie, all lights the same color)
+        block = 0;
+        position = 0;
+    }
+
+    m_patternPositions[i] = block == PixelBuffer::NoBlock ? NoPosition : position;
+  }
+
+  m_positionsPattern = m_pattern;
+}
@@ -0,0 +1,55 @@
+#include "LightStyle.h"
+#include "Arduino.h"
+#include "PixelBuffer.h"
+
+#ifndef SPATIAL_STYLE_H
+#define SPATIAL_STYLE_H
+
+// A style that computes every pixel's color from where the pixel is and the current time,
+// instead of shifting the colors already in the buffer.
+// Every frame costs the same no matter the pattern, the style can start anywhere in time,
+// and a speed change doesn't leave a seam in the colors already on the sign.
+class SpatialStyle : public LightStyle {
+  public:
+    SpatialStyle(String name, PixelBuffer* pixelBuffer);
+
+    // Restarts the style's clock. The pixels are drawn on the next update.
+    void reset();
+    void update();
+
+    // Every pattern, including the radial ones.
+    StyleCapabilities getCapabilities();
+
+  protected:
+    // Positions are in 1/PositionScale of a block (a row or column), so a pixel's place
+    // on the sign isn't rounded to the block it's in.
+    static constexpr uint16_t PositionScale = 16;
+
+    // Gets the time (in msec) between ticks of the style's clock.
+    virtual unsigned long getTickPeriod() = 0;
+
+    // Gets the color of a pixel.
+    // position is the pixel's distance along the pattern, in 1/PositionScale of a block, from
+    // where the shifting styles add new colors. It comes from the pixel's x for Right and Left,
+    // its y for Up and Down, its distance from the center for Ripple, and its angle for Spin
+    // (a full turn is 16 blocks). Digit and Random use the digit and the pixel index, and
+    // it's always 0 for Solid. ticks counts up from the last reset(); each tick moves the
+    // colors on by one block.
+    virtual uint32_t getPixelColor(unsigned int pixel, uint16_t position, unsigned long ticks) = 0;
+
+  private:
+    static constexpr uint16_t NoPosition = 0xFFFF;
+
+    void buildPatternPositions();
+
+    // Each pixel's position along the current pattern, or NoPosition if it isn't part of it.
+    uint16_t m_patternPositions[ActiveLayout::PixelCount];
+    byte m_positionsPattern{0xFF};
+
+    unsigned long m_ticks{0};
+    unsigned long m_elapsed{0};
+    unsigned long m_lastUpdate{0};
+    bool m_needsRender{true};
+};
+
+#endif
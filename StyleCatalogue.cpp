@@ -0,0 +1,67 @@
+#include <vector>
+#include "Arduino.h"
+#include "StyleCatalogue.h"
+#include "Crc32.h"
+#include "LightStyle.h"
+
+bool StyleCatalogue::build(const std::vector<LightStyle*>& styles, const std::vector<String>& patternNames) {
+  m_length = 0;
+  m_isTruncated = false;
+  appendByte(STYLE_CATALOGUE_VERSION);
+  appendByte(patternNames.size());
+  appendByte(styles.size());
+
+  for (int i = 0; i < patternNames.size(); i++) {
+    appendByte(i);
+    appendName(patternNames[i]);
+  }
+
+  for (int i = 0; i < styles.size(); i++) {
+    StyleCapabilities capabilities = styles[i]->getCapabilities();
+    appendByte(i);
+    appendByte(capabilities.patterns & 0xFF);
+    appendByte(capabilities.patterns >> 8);
+    appendByte(capabilities.minSpeed);
+    appendByte(capabilities.maxSpeed);
+    appendByte(capabilities.minStep);
+    appendByte(capabilities.maxStep);
+    appendName(styles[i]->getName());
+  }
+
+  if (m_isTruncated) {
+    Serial.println("The style catalogue is too big - increase STYLE_CATALOGUE_MAXSIZE.");
+  }
+
+  uint32_t lastHash = m_hash;
+  m_hash = Crc32::compute(m_data, m_length);
+  return m_hash != lastHash;
+}
+
+const uint8_t* StyleCatalogue::getData() {
+  return m_data;
+}
+
+uint16_t StyleCatalogue::getLength() {
+  return m_length;
+}
+
+uint32_t StyleCatalogue::getHash() {
+  return m_hash;
+}
+
+void StyleCatalogue::appendByte(uint8_t value) {
+  if (m_length == STYLE_CATALOGUE_MAXSIZE) {
+    m_isTruncated = true;
+    return;
+  }
+
+  m_data[m_length++] = value;
+}
+
+void StyleCatalogue::appendName(const String& name) {
+  uint8_t length = name.length() > 255 ? 255 : name.length();
+  appendByte(length);
+  for (int i = 0; i < length; i++) {
+    appendByte(name.charAt(i));
+  }
+}
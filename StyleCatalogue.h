@@ -0,0 +1,43 @@
+#include <vector>
+#include "Arduino.h"
+#include "LightStyle.h"
+
+#ifndef STYLE_CATALOGUE_H
+#define STYLE_CATALOGUE_H
+
+#define STYLE_CATALOGUE_VERSION 1
+#define STYLE_CATALOGUE_MAXSIZE 1024
+
+// The styles and patterns, packed into a binary catalogue for the phone app.
+//
+// The catalogue (version 1) is:
+//   version, pattern count, style count (1 byte each)
+//   for each pattern: id, name length, name (UTF-8, not terminated)
+//   for each style:   id, pattern bits (uint16, little-endian), min speed, max speed,
+//                     min step, max step, name length, name
+// The ids are the indexes used by the style and pattern characteristics.
+// Names longer than 255 bytes are cut off.
+class StyleCatalogue {
+  public:
+    // Rebuilds the catalogue. Returns true if its hash is different from before.
+    bool build(const std::vector<LightStyle*>& styles, const std::vector<String>& patternNames);
+
+    const uint8_t* getData();
+    uint16_t getLength();
+
+    // Gets the CRC-32 of the catalogue. The version is the first byte, so it's covered too.
+    // Clients keep the hash of the copy they read, and only read it again when it's different,
+    // so a catalogue that comes out the same after a restart isn't read again.
+    uint32_t getHash();
+
+  private:
+    uint8_t m_data[STYLE_CATALOGUE_MAXSIZE];
+    uint16_t m_length{0};
+    uint32_t m_hash{0};
+    bool m_isTruncated{false};
+
+    void appendByte(uint8_t value);
+    void appendName(const String& name);
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "Arduino.h"
+#include "StyleTransition.h"
+#include "PixelBuffer.h"
+#include "PixelLayer.h"
+
+StyleTransition::StyleTransition(PixelBuffer* pixelBuffer) : m_layer(BlendMode::Over) {
+  m_pixelBuffer = pixelBuffer;
+  m_layer.setEnabled(false);
+}
+
+void StyleTransition::initialize() {
+  m_pixelBuffer->addLayer(&m_layer);
+}
+
+void StyleTransition::setDuration(unsigned int msec) {
+  m_duration = msec;
+}
+
+void StyleTransition::start() {
+  if (m_duration == 0) {
+    return;
+  }
+
+  // Start from the blended output, so a change in the middle of a fade doesn't jump,
+  // and leaving low power fades in from the covered frame instead of the stale style.
+  m_layer.copyBlendedPixels(m_pixelBuffer);
+  m_layer.setAlpha(255);
+  m_layer.setEnabled(true);
+  m_startTime = millis();
+}
+
+void StyleTransition::update() {
+  if (!isActive()) {
+    return;
+  }
+
+  unsigned long elapsed = millis() - m_startTime;
+  if (elapsed >= m_duration) {
+    m_layer.setEnabled(false);
+    return;
+  }
+
+  uint8_t alpha = 255 - elapsed * 255 / m_duration;
+  if (alpha != m_layer.getAlpha()) {
+    m_layer.setAlpha(alpha);
+  }
+}
+
+bool StyleTransition::isActive() {
+  return m_layer.isActive();
+}
@@ -0,0 +1,40 @@
+#include "Arduino.h"
+#include "PixelBuffer.h"
+#include "PixelLayer.h"
+
+#ifndef STYLE_TRANSITION_H
+#define STYLE_TRANSITION_H
+
+// Cross-fades from what's on the sign to whatever the next style draws.
+// The last frame is copied into a layer on top of the PixelBuffer, which fades out over
+// the transition while the new style runs underneath it.
+class StyleTransition {
+  public:
+    StyleTransition(PixelBuffer* pixelBuffer);
+
+    // Adds the fade layer to the PixelBuffer.
+    void initialize();
+
+    // Sets the length of the cross-fade (in msec). 0 turns the cross-fade off.
+    void setDuration(unsigned int msec);
+
+    // Starts a cross-fade from what's on the sign now: the pixels with every active layer
+    // blended on top, including any fade still in progress or anything covering the style.
+    // Call this before resetting the new style, and before turning off a layer that's
+    // covering the style.
+    void start();
+
+    // Updates the fade. Call this once per loop, before displaying the pixels.
+    void update();
+
+    // Indicates a cross-fade is in progress.
+    bool isActive();
+
+  private:
+    PixelBuffer* m_pixelBuffer;
+    PixelLayer m_layer;
+    unsigned long m_startTime{0};
+    unsigned int m_duration{0};
+};
+
+#endif
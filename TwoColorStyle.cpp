@@ -10,7 +10,7 @@ TwoColorStyle::TwoColorStyle(String name, uint32_t color1, uint32_t color2, Pixe
 }
 
 void TwoColorStyle::update() {
-  if (millis() < m_nextUpdate) {
+  if (!m_isFreeRunning && millis() < m_nextUpdate) {
     return;
   }
 
@@ -21,7 +21,7 @@ void TwoColorStyle::update() {
     primaryColor = m_color2;
     secondaryColor = m_color1;
   }
-  int mod = getModulus();
+  int mod = m_modulus;
   uint32_t newColor = primaryColor;
   if (mod > 0 && m_iterationCount % mod == 0) {
     newColor = secondaryColor;
@@ -35,14 +35,14 @@ void TwoColorStyle::update() {
   }
   
   m_iterationCount++;
-  m_nextUpdate = millis() + getIterationDelay();
+  m_nextUpdate = millis() + m_iterationDelay;
 }
 
 void TwoColorStyle::reset()
 {
   uint32_t primaryColor = m_color1;
   uint32_t secondaryColor = m_color2;
-  int mod = getModulus();
+  int mod = m_modulus;
 
   if (m_step > 50) {
     primaryColor = m_color2;
@@ -63,46 +63,69 @@ void TwoColorStyle::reset()
     return;
   }
 
+  if (!canSetBlocksUsingPattern()) {
+    for (int i = 0; i < numBlocks; i++) {
+      if (mod > 0 && i % mod == 0) {
+        shiftColorUsingPattern(secondaryColor);
+      } else {
+        shiftColorUsingPattern(primaryColor);
+      }
+    }
+
+    return;
+  }
+
+  // Give each block the color it would have after shifting in numBlocks colors:
+  // the first color ends up in the last block.
   for (int i = 0; i < numBlocks; i++) {
     if (mod > 0 && i % mod == 0) {
-      shiftColorUsingPattern(secondaryColor);
+      setBlockColorUsingPattern(numBlocks - 1 - i, secondaryColor);
     } else {
-      shiftColorUsingPattern(primaryColor);
+      setBlockColorUsingPattern(numBlocks - 1 - i, primaryColor);
     }
   }
 }
 
-int TwoColorStyle::getIterationDelay() {
+void TwoColorStyle::setSpeed(byte speed) {
+  LightStyle::setSpeed(speed);
+  m_iterationDelay = getIterationDelay(speed);
+}
+
+void TwoColorStyle::setStep(byte step) {
+  LightStyle::setStep(step);
+  m_modulus = getModulus(step);
+}
+
+int TwoColorStyle::getIterationDelay(byte speed) {
   // Convert "speed" to a delay.
-  // Speed ranges from 1 to 100.
+  // Speed ranges from 1 to 100.  100 correlates to "fastest", ie, min delay.
+  // Integer math only -- the decrease is rounded up so the result matches
+  // the truncated floating-point linear mapping.
   int minDelay = 20;
   int maxDelay = 800;
-  int minSpeed = 100;  // Yes, reversed.  100 correlates to "fastest", ie, min delay
-  int maxSpeed = 1;
-  double m = (double)(maxDelay - minDelay)/(maxSpeed - minSpeed);
-  double b = maxDelay - m;
-  int delay = m_speed*m + b;
-  return delay;
+  int minSpeed = 1;
+  int maxSpeed = 100;
+  int speedRange = maxSpeed - minSpeed;
+  return maxDelay - ((speed - minSpeed) * (maxDelay - minDelay) + speedRange - 1) / speedRange;
 }
 
-int TwoColorStyle::getModulus() {
+int TwoColorStyle::getModulus(byte step) {
   // Convert "step" to a modulus -- every "modulus" pixel will be the secondary color.
   // Step ranges from 1 to 100.
   // The modulus will be the minumum (2) at 50, and increase as you go away from 50.
+  // Everything is doubled so the midpoint (49.5) is an integer.
   int minMod = 2;
   int maxMod = 10;
   int minStep = 1;
   int maxStep = 100;
-  double midStep = (double)(maxStep - minStep) / 2.0;
-  int x = abs(m_step - midStep);
+  int doubleMidStep = maxStep - minStep;
+  int x = abs(2 * step - doubleMidStep) / 2;
   // If we're within about 5 of the max/min, report no mod so it's a solid color.
-  if (midStep - x < 5) {
+  if (doubleMidStep - 2 * x < 10) {
     return -1;
   }
-  double m = (double)(maxMod - minMod)/(midStep - minStep);
-  double b = minMod;
-  int mod = x*m + b;
-  return mod;
+
+  return minMod + 2 * x * (maxMod - minMod) / (doubleMidStep - 2 * minStep);
 }
 
 
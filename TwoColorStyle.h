@@ -9,17 +9,22 @@ class TwoColorStyle : public LightStyle {
   public:
     TwoColorStyle(String name, uint32_t color1, uint32_t color2, PixelBuffer* pixelBuffer);
     
+    void setSpeed(byte speed);
+    void setStep(byte step);
     void reset();
     void update();
 
-  private:
-    int getIterationDelay();
-    int getModulus();
+    // The speed/step mappings, shared with the spatially-rendered version of the style.
+    static int getIterationDelay(byte speed);
+    static int getModulus(byte step);
 
+  private:
     uint32_t m_color1;
     uint32_t m_color2;
     int m_iterationCount;
     unsigned long m_nextUpdate;
+    int m_iterationDelay{0};
+    int m_modulus{-1};
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "Arduino.h"
+#include "TwoColorWaveStyle.h"
+#include "TwoColorStyle.h"
+#include "PixelBuffer.h"
+
+TwoColorWaveStyle::TwoColorWaveStyle(String name, uint32_t color1, uint32_t color2, PixelBuffer* pixelBuffer) : SpatialStyle(name, pixelBuffer) {
+  m_color1 = color1;
+  m_color2 = color2;
+}
+
+void TwoColorWaveStyle::setSpeed(byte speed) {
+  LightStyle::setSpeed(speed);
+  m_tickPeriod = TwoColorStyle::getIterationDelay(speed);
+}
+
+void TwoColorWaveStyle::setStep(byte step) {
+  LightStyle::setStep(step);
+  m_modulus = TwoColorStyle::getModulus(step);
+}
+
+unsigned long TwoColorWaveStyle::getTickPeriod() {
+  return m_tickPeriod;
+}
+
+uint32_t TwoColorWaveStyle::getPixelColor(unsigned int pixel, uint16_t position, unsigned long ticks) {
+  uint32_t primaryColor = m_color1;
+  uint32_t secondaryColor = m_color2;
+  if (m_step > 50) {
+    primaryColor = m_color2;
+    secondaryColor = m_color1;
+  }
+
+  if (m_modulus <= 0) {
+    return primaryColor;
+  }
+
+  // The stripes have hard edges, so work in whole blocks.
+  uint16_t block = (position + PositionScale / 2) / PositionScale;
+
+  // TwoColorStyle shifts rows and columns 2 at a time, so each update covers 2 blocks.
+  if (m_pattern >= 1 && m_pattern <= 4) {
+    block /= 2;
+  }
+
+  // Same as (ticks - block) % modulus, but without going negative.
+  unsigned long iteration = ticks + m_modulus - block % m_modulus;
+  return iteration % m_modulus == 0 ? secondaryColor : primaryColor;
+}
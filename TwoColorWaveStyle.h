@@ -0,0 +1,27 @@
+#include "SpatialStyle.h"
+#include "Arduino.h"
+#include "PixelBuffer.h"
+
+#ifndef TWO_COLOR_WAVE_STYLE_H
+#define TWO_COLOR_WAVE_STYLE_H
+
+// The two-color style, drawn spatially. Speed and step mean the same as for TwoColorStyle.
+class TwoColorWaveStyle : public SpatialStyle {
+  public:
+    TwoColorWaveStyle(String name, uint32_t color1, uint32_t color2, PixelBuffer* pixelBuffer);
+
+    void setSpeed(byte speed);
+    void setStep(byte step);
+
+  protected:
+    unsigned long getTickPeriod();
+    uint32_t getPixelColor(unsigned int pixel, uint16_t position, unsigned long ticks);
+
+  private:
+    uint32_t m_color1;
+    uint32_t m_color2;
+    unsigned long m_tickPeriod{800};
+    int m_modulus{-1};
+};
+
+#endif
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <map>
+#include "Arduino.h"
+#include "FrameEncoder.h"
+
+FrameEncoder::FrameEncoder(int maxPacketSize) {
+  m_maxDataSize = maxPacketSize - FRAME_STREAM_HEADERSIZE;
+  memset(m_lastColors, 0, sizeof(m_lastColors));
+}
+
+std::vector<FramePacket> FrameEncoder::encodeFrame(const uint32_t* colors) {
+  std::vector<FramePacket> packets;
+  const int pixelCount = ActiveLayout::PixelCount;
+
+  // Find the span of pixels that changed. The sign starts each frame from the last one,
+  // so nothing outside it needs to be sent.
+  int first = 0;
+  int last = pixelCount - 1;
+  if (m_hasLastFrame) {
+    while (first < pixelCount && colors[first] == m_lastColors[first]) {
+      first++;
+    }
+
+    while (last >= first && colors[last] == m_lastColors[last]) {
+      last--;
+    }
+  }
+
+  memcpy(m_lastColors, colors, sizeof(m_lastColors));
+  m_hasLastFrame = true;
+  int count = last - first + 1;
+  if (count <= 0) {
+    // Nothing changed, but the frame still has to arrive to be shown.
+    m_lastEncoding = FrameEncodingRaw;
+    addPacket(packets, FrameEncodingRaw, 0, nullptr, 0);
+    packets.back()[2] |= FRAME_STREAM_LASTPACKET;
+    m_frameNumber++;
+    return packets;
+  }
+
+  // Four-bit indices are packed in pairs, so an odd span would write the spare
+  // high nibble over the next pixel. Take that pixel into the span instead.
+  if (count % 2 != 0 && last + 1 < pixelCount) {
+    last++;
+    count++;
+  }
+
+  // Build the palette in the order the colors first appear.
+  // More than 256 colors can only be sent raw.
+  std::vector<uint32_t> palette;
+  std::map<uint32_t, uint8_t> paletteIndices;
+  std::vector<uint8_t> indices(count);
+  bool canUsePalette = true;
+  for (int i = 0; i < count && canUsePalette; i++) {
+    auto entry = paletteIndices.find(colors[first + i]);
+    if (entry == paletteIndices.end()) {
+      canUsePalette = palette.size() < 256;
+      entry = paletteIndices.emplace(colors[first + i], (uint8_t)palette.size()).first;
+      palette.push_back(colors[first + i]);
+    }
+
+    indices[i] = entry->second;
+  }
+
+  // Work out how big each encoding of the span would be, palette included.
+  int rawSize = count * 3;
+  int bestSize = rawSize;
+  FrameEncoding encoding = FrameEncodingRaw;
+  std::vector<uint8_t> runs;
+  if (canUsePalette) {
+    int paletteSize = palette.size() * 3;
+    for (int i = 0; i < count; ) {
+      int runLength = 1;
+      while (i + runLength < count && runLength < 255 && indices[i + runLength] == indices[i]) {
+        runLength++;
+      }
+
+      runs.push_back(runLength);
+      runs.push_back(indices[i]);
+      i += runLength;
+    }
+
+    if (paletteSize + count < bestSize) {
+      bestSize = paletteSize + count;
+      encoding = FrameEncodingIndexed8;
+    }
+
+    if (palette.size() <= 16 && paletteSize + (count + 1) / 2 < bestSize) {
+      bestSize = paletteSize + (count + 1) / 2;
+      encoding = FrameEncodingIndexed4;
+    }
+
+    if (paletteSize + (int)runs.size() < bestSize) {
+      bestSize = paletteSize + runs.size();
+      encoding = FrameEncodingRuns;
+    }
+  }
+
+  m_lastEncoding = encoding;
+  std::vector<uint8_t> data;
+  if (encoding != FrameEncodingRaw) {
+    for (uint32_t color : palette) {
+      data.push_back(color >> 16);
+      data.push_back(color >> 8);
+      data.push_back(color);
+    }
+
+    int entriesPerPacket = m_maxDataSize / 3;
+    for (int entry = 0; entry < palette.size(); entry += entriesPerPacket) {
+      int entries = std::min((int)palette.size() - entry, entriesPerPacket);
+      addPacket(packets, FrameEncodingPalette, entry, data.data() + entry * 3, entries * 3);
+    }
+  }
+
+  // Split the pixels between packets, on whole pixels (or runs).
+  data.clear();
+  switch (encoding) {
+    case FrameEncodingRaw: {
+      for (int i = first; i <= last; i++) {
+        data.push_back(colors[i] >> 16);
+        data.push_back(colors[i] >> 8);
+        data.push_back(colors[i]);
+      }
+
+      int pixelsPerPacket = m_maxDataSize / 3;
+      for (int i = 0; i < count; i += pixelsPerPacket) {
+        addPacket(packets, encoding, first + i, data.data() + i * 3, std::min(count - i, pixelsPerPacket) * 3);
+      }
+
+      break;
+    }
+
+    case FrameEncodingIndexed8:
+      for (int i = 0; i < count; i += m_maxDataSize) {
+        addPacket(packets, encoding, first + i, indices.data() + i, std::min(count - i, m_maxDataSize));
+      }
+
+      break;
+
+    case FrameEncodingIndexed4: {
+      for (int i = 0; i < count; i += 2) {
+        data.push_back(indices[i] | (i + 1 < count ? indices[i + 1] << 4 : 0));
+      }
+
+      for (int i = 0; i < data.size(); i += m_maxDataSize) {
+        addPacket(packets, encoding, first + i * 2, data.data() + i, std::min((int)data.size() - i, m_maxDataSize));
+      }
+
+      break;
+    }
+
+    default: {
+      int pairsPerPacket = m_maxDataSize / 2;
+      int pixel = first;
+      for (int i = 0; i < runs.size(); i += pairsPerPacket * 2) {
+        int length = std::min((int)runs.size() - i, pairsPerPacket * 2);
+        addPacket(packets, encoding, pixel, runs.data() + i, length);
+        for (int j = 0; j < length; j += 2) {
+          pixel += runs[i + j];
+        }
+      }
+
+      break;
+    }
+  }
+
+  packets.back()[2] |= FRAME_STREAM_LASTPACKET;
+  m_frameNumber++;
+  return packets;
+}
+
+void FrameEncoder::reset() {
+  m_hasLastFrame = false;
+}
+
+FrameEncoding FrameEncoder::getLastEncoding() {
+  return m_lastEncoding;
+}
+
+void FrameEncoder::addPacket(std::vector<FramePacket>& packets, FrameEncoding encoding, uint16_t start, const uint8_t* data, int length) {
+  FramePacket packet(FRAME_STREAM_HEADERSIZE + length);
+  packet[0] = m_frameNumber;
+  packet[1] = packets.size();
+  packet[2] = packets.empty() ? FRAME_STREAM_FIRSTPACKET : 0;
+  packet[3] = encoding;
+  packet[4] = start & 0xFF;
+  packet[5] = start >> 8;
+  if (length > 0) {
+    memcpy(packet.data() + FRAME_STREAM_HEADERSIZE, data, length);
+  }
+
+  packets.push_back(packet);
+}
@@ -0,0 +1,40 @@
+// Encodes frames into FrameStream packets, the way a client streaming to the sign would.
+// FrameStreamTest decodes them again to check the two sides agree, and RunBenchmarks
+// uses it to see how many frames per second fit through a BLE link.
+#include <vector>
+#include "Arduino.h"
+#include "FrameStream.h"
+
+#ifndef FRAME_ENCODER_H
+#define FRAME_ENCODER_H
+
+typedef std::vector<uint8_t> FramePacket;
+
+class FrameEncoder {
+  public:
+    // Packets are at most maxPacketSize bytes, header included.
+    FrameEncoder(int maxPacketSize = FRAME_STREAM_MAXPACKETSIZE);
+
+    // Encodes a frame of ActiveLayout::PixelCount colors as the packets that turn the
+    // last frame encoded into this one. Only the span of pixels that changed is sent,
+    // with whichever encoding makes it smallest.
+    std::vector<FramePacket> encodeFrame(const uint32_t* colors);
+
+    // Forgets the last frame, so the next one covers every pixel.
+    // Call this when a packet was lost, since the sign will have dropped that frame.
+    void reset();
+
+    // Gets the encoding used for the pixels of the last frame.
+    FrameEncoding getLastEncoding();
+
+  private:
+    int m_maxDataSize;
+    uint32_t m_lastColors[ActiveLayout::PixelCount];
+    bool m_hasLastFrame{false};
+    uint8_t m_frameNumber{0};
+    FrameEncoding m_lastEncoding{FrameEncodingRaw};
+
+    void addPacket(std::vector<FramePacket>& packets, FrameEncoding encoding, uint16_t start, const uint8_t* data, int length);
+};
+
+#endif
@@ -0,0 +1,41 @@
+// Prints the PixelInfo table for a layout, ready to paste into PixelLayouts.h.
+//
+//   GeneratePixelInfo SignLayout|TestRingLayout
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "PixelInfoGenerator.h"
+
+#define GENERATE_PIXELINFO_PERLINE 6
+
+static void printTable(const PixelBlockMap& rows, const PixelBlockMap& columns, const PixelBlockMap& digits, uint16_t pixelCount) {
+  std::vector<PixelInfo> pixels(pixelCount);
+  buildPixelInfo(rows, columns, digits, pixelCount, pixels.data());
+
+  printf("  // Generated by host/GeneratePixelInfo from the block maps above. Don't edit by hand.\n");
+  printf("  // Each entry is { column, row, digit, x, y, angle, radius }.\n");
+  printf("  constexpr PixelInfo Pixels[] = {\n");
+  for (int i = 0; i < pixelCount; i++) {
+    const PixelInfo& info = pixels[i];
+    bool isLineStart = i % GENERATE_PIXELINFO_PERLINE == 0;
+    bool isLineEnd = i % GENERATE_PIXELINFO_PERLINE == GENERATE_PIXELINFO_PERLINE - 1 || i == pixelCount - 1;
+    printf("%s{%d,%d,%d,%d,%d,%d,%d}%s%s", isLineStart ? "    " : "",
+      info.column, info.row, info.digit, info.x, info.y, info.angle, info.radius,
+      i == pixelCount - 1 ? "" : ",", isLineEnd ? "\n" : " ");
+  }
+
+  printf("  };\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc == 2 && strcmp(argv[1], "SignLayout") == 0) {
+    printTable(SignLayout::Rows, SignLayout::Columns, SignLayout::Digits, SignLayout::PixelCount);
+  } else if (argc == 2 && strcmp(argv[1], "TestRingLayout") == 0) {
+    printTable(TestRingLayout::Rows, TestRingLayout::Columns, TestRingLayout::Digits, TestRingLayout::PixelCount);
+  } else {
+    fprintf(stderr, "Usage: %s SignLayout|TestRingLayout\n", argv[0]);
+    return 2;
+  }
+
+  return 0;
+}
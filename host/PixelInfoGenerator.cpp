@@ -0,0 +1,47 @@
+#include "Arduino.h"
+#include "PixelInfoGenerator.h"
+
+static void setBlocks(const PixelBlockMap& blocks, uint16_t pixelCount, PixelInfo* pixels, uint8_t PixelInfo::* blockField) {
+  for (int i = 0; i < pixelCount; i++) {
+    pixels[i].*blockField = PIXEL_LAYOUTS_NOBLOCK;
+  }
+
+  for (int block = 0; block < blocks.blockCount; block++) {
+    for (uint16_t i = blocks.offsets[block]; i < blocks.offsets[block + 1]; i++) {
+      pixels[blocks.hasPixels ? blocks.pixels[i] : i].*blockField = block;
+    }
+  }
+}
+
+void buildPixelInfo(const PixelBlockMap& rows, const PixelBlockMap& columns, const PixelBlockMap& digits,
+  uint16_t pixelCount, PixelInfo* pixels) {
+  setBlocks(rows, pixelCount, pixels, &PixelInfo::row);
+  setBlocks(columns, pixelCount, pixels, &PixelInfo::column);
+  setBlocks(digits, pixelCount, pixels, &PixelInfo::digit);
+
+  // The coordinates come from the row and column indices, treating the
+  // rows and columns as evenly spaced. Pixels without a row or column
+  // are put in the middle of the sign on that axis.
+  float centerX = (columns.blockCount - 1) / 2.0f;
+  float centerY = (rows.blockCount - 1) / 2.0f;
+  float maxRadius = sqrtf(centerX * centerX + centerY * centerY);
+  for (int i = 0; i < pixelCount; i++) {
+    PixelInfo& info = pixels[i];
+    float x = info.column == PIXEL_LAYOUTS_NOBLOCK ? centerX : info.column;
+    float y = info.row == PIXEL_LAYOUTS_NOBLOCK ? centerY : info.row;
+    info.x = centerX > 0 ? (uint8_t)(x * 255 / (2 * centerX) + 0.5f) : 128;
+    info.y = centerY > 0 ? (uint8_t)(y * 255 / (2 * centerY) + 0.5f) : 128;
+
+    float dx = x - centerX;
+    float dy = y - centerY;
+    info.radius = maxRadius > 0 ? (uint8_t)(sqrtf(dx * dx + dy * dy) * 255 / maxRadius + 0.5f) : 0;
+
+    // atan2 gives -pi to pi; map that onto 0-255, wrapping 256 back to 0.
+    float turns = atan2f(dy, dx) / TWO_PI;
+    if (turns < 0) {
+      turns += 1;
+    }
+
+    info.angle = (uint8_t)((int)(turns * 256 + 0.5f) & 0xFF);
+  }
+}
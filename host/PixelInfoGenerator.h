@@ -0,0 +1,12 @@
+// Builds the PixelInfo table for a layout from its block maps.
+// GeneratePixelInfo prints the tables in PixelLayouts.h with this, and PixelInfoTest checks
+// them against it, so a layout change that isn't regenerated fails the tests.
+#include "PixelLayouts.h"
+
+#ifndef PIXEL_INFO_GENERATOR_H
+#define PIXEL_INFO_GENERATOR_H
+
+void buildPixelInfo(const PixelBlockMap& rows, const PixelBlockMap& columns, const PixelBlockMap& digits,
+  uint16_t pixelCount, PixelInfo* pixels);
+
+#endif
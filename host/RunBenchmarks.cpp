@@ -0,0 +1,154 @@
+// Runs the on-device benchmarks on the host, with heap allocations counted.
+// Exits with 1 if a steady-state frame allocates, or a streamed frame is lost.
+//
+//   RunBenchmarks [--iterations N] [--shifts] [--styles] [--allocations] [--stream]
+//
+// With none of the group options, every group runs. The host numbers are only useful
+// for comparing one version of the code with another; the board is many times slower.
+//
+// The stream group encodes each style's frames the way a client streaming them would,
+// and works out how many frames per second a BLE link could carry.
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "Sketch.h"
+#include "Benchmarks.h"
+#include "FrameEncoder.h"
+#include "FrameStream.h"
+
+// The link the stream benchmark assumes: a 7.5 msec connection interval, with
+// this many full-size writes without response in each connection event.
+#define STREAM_CONNECTIONINTERVALUSEC 7500
+#define STREAM_PACKETSPEREVENT 6
+
+// The rate the styles are rendered at for the stream benchmark.
+#define STREAM_FRAMEPERIODUSEC 33333
+
+extern std::vector<LightStyle*> lightStyles;
+
+static FrameStream s_frameStream;
+static uint32_t s_colors[ActiveLayout::PixelCount];
+
+// Streams each style through the encoder and decoder over a simulated link.
+// Returns false if the decoder lost a frame or showed one wrong.
+static bool runStreamBenchmarks(unsigned int iterations) {
+  printf("Running frame stream benchmarks (%d packets every %d usec)...\n", STREAM_PACKETSPEREVENT, STREAM_CONNECTIONINTERVALUSEC);
+  printf("%-16s %-10s %10s %10s %10s %10s\n", "style", "pattern", "packets", "bytes", "decode us", "max fps");
+
+  bool isStreamIntact = true;
+  double packetsPerSecond = STREAM_PACKETSPEREVENT * 1000000.0 / STREAM_CONNECTIONINTERVALUSEC;
+  for (LightStyle* style : lightStyles) {
+    style->setSpeed(100);
+    style->setStep(50);
+    for (int pattern = 0; pattern < LightStyle::knownPatterns.size(); pattern++) {
+      style->setPattern(pattern);
+      style->reset();
+
+      FrameEncoder encoder;
+      unsigned long packetCount = 0;
+      unsigned long byteCount = 0;
+      unsigned long startFrames = s_frameStream.getFrameCount();
+      unsigned long startDropped = s_frameStream.getDroppedFrameCount();
+      std::chrono::steady_clock::duration decodeTime{0};
+      for (unsigned int frame = 0; frame < iterations; frame++) {
+        Host::advanceClock(STREAM_FRAMEPERIODUSEC);
+        style->update();
+        pixelBuffer.getPixels(s_colors);
+
+        std::vector<FramePacket> packets = encoder.encodeFrame(s_colors);
+        auto start = std::chrono::steady_clock::now();
+        for (const FramePacket& packet : packets) {
+          s_frameStream.receivePacket(packet.data(), packet.size());
+        }
+
+        decodeTime += std::chrono::steady_clock::now() - start;
+        packetCount += packets.size();
+        for (const FramePacket& packet : packets) {
+          byteCount += packet.size();
+        }
+
+        s_frameStream.copyFrame(&pixelBuffer);
+        for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+          if (pixelBuffer.getPixel(i) != s_colors[i]) {
+            isStreamIntact = false;
+            break;
+          }
+        }
+      }
+
+      if (s_frameStream.getFrameCount() - startFrames != iterations || s_frameStream.getDroppedFrameCount() != startDropped) {
+        isStreamIntact = false;
+      }
+
+      double decodeMicros = std::chrono::duration<double, std::micro>(decodeTime).count() / iterations;
+      double packetsPerFrame = (double)packetCount / iterations;
+      printf("%-16s %-10s %10.1f %10.1f %10.2f %10.1f\n", style->getName().c_str(), LightStyle::knownPatterns[pattern].c_str(),
+        packetsPerFrame, (double)byteCount / iterations, decodeMicros, packetsPerSecond / packetsPerFrame);
+    }
+  }
+
+  if (!isStreamIntact) {
+    printf("FAIL: a streamed frame was lost or came out different.\n");
+  }
+
+  return isStreamIntact;
+}
+
+int main(int argc, char** argv) {
+  unsigned int iterations = 1000;
+  bool runShifts = false;
+  bool runStyles = false;
+  bool runAllocations = false;
+  bool runStream = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--shifts") == 0) {
+      runShifts = true;
+    } else if (strcmp(argv[i], "--styles") == 0) {
+      runStyles = true;
+    } else if (strcmp(argv[i], "--allocations") == 0) {
+      runAllocations = true;
+    } else if (strcmp(argv[i], "--stream") == 0) {
+      runStream = true;
+    } else {
+      fprintf(stderr, "Usage: %s [--iterations N] [--shifts] [--styles] [--allocations] [--stream]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (!runShifts && !runStyles && !runAllocations && !runStream) {
+    runShifts = runStyles = runAllocations = runStream = true;
+  }
+
+  pixelBuffer.initialize();
+  initializeLightStyles();
+
+  Benchmarks benchmarks(&pixelBuffer, iterations);
+  if (runShifts) {
+    benchmarks.runShiftBenchmarks();
+  }
+
+  if (runStyles) {
+    benchmarks.runStyleBenchmarks(lightStyles);
+  }
+
+  // The allocation check and the stream check are the only pass/fail results.
+  // They wait for frames and animate the styles off millis(), so they run on a simulated
+  // clock. It starts where the real one is, so the styles' next update times are still in
+  // range, and it stays on to the end, since the styles are left ahead of the real clock.
+  unsigned long startMicros = micros();
+  Host::useSimulatedClock(true);
+  Host::advanceClock(startMicros);
+
+  bool isPassing = true;
+  if (runAllocations && !benchmarks.runAllocationCheck(lightStyles)) {
+    isPassing = false;
+  }
+
+  if (runStream && !runStreamBenchmarks(iterations)) {
+    isPassing = false;
+  }
+
+  return isPassing ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+// Runs the sketch on the host against the stand-in Arduino libraries.
+//
+//   Simulator [--seconds N] [--simulated-clock] [--capture FILE] [--flash FILE]
+//
+// --seconds          How long to run for (default 10).
+// --simulated-clock  Run as fast as possible on a simulated clock, so runs are repeatable.
+//                    Only the LED transfer takes simulated time (as long as it does on the
+//                    board), so the loop timing shows the display phase but reads 0 for BLE,
+//                    buttons and style. Time those on the real clock (without this option).
+// --capture          Write every frame sent to the LEDs to FILE (see PixelBuffer::setCaptureOutput).
+// --flash            Keep the flash in FILE, so the saved settings carry over to the next run.
+#include <stdio.h>
+#include <string.h>
+#include "FlashIAP.h"
+#include "Sketch.h"
+
+// The battery voltage input reading for a full battery (about 7.7V).
+#define SIMULATOR_BATTERYLEVEL 800
+
+// How far the simulated clock moves between passes through the loop, outside any phase.
+#define SIMULATOR_LOOPMICROS 100
+
+class FilePrint : public Print {
+  public:
+    FilePrint(FILE* file) : m_file(file) {}
+    size_t write(uint8_t value) { return fwrite(&value, 1, 1, m_file); }
+    size_t write(const uint8_t* buffer, size_t size) { return fwrite(buffer, 1, size, m_file); }
+
+  private:
+    FILE* m_file;
+};
+
+int main(int argc, char** argv) {
+  unsigned long seconds = 10;
+  bool isClockSimulated = false;
+  const char* capturePath = nullptr;
+  const char* flashPath = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--simulated-clock") == 0) {
+      isClockSimulated = true;
+    } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+      capturePath = argv[++i];
+    } else if (strcmp(argv[i], "--flash") == 0 && i + 1 < argc) {
+      flashPath = argv[++i];
+    } else {
+      fprintf(stderr, "Usage: %s [--seconds N] [--simulated-clock] [--capture FILE] [--flash FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  FILE* captureFile = nullptr;
+  FilePrint* captureOutput = nullptr;
+  if (capturePath != nullptr) {
+    captureFile = fopen(capturePath, "wb");
+    if (captureFile == nullptr) {
+      perror(capturePath);
+      return 1;
+    }
+
+    captureOutput = new FilePrint(captureFile);
+    pixelBuffer.setCaptureOutput(captureOutput);
+  }
+
+  if (flashPath != nullptr && !Host::setFlashFile(flashPath)) {
+    perror(flashPath);
+    return 1;
+  }
+
+  Host::useSimulatedClock(isClockSimulated);
+  Host::setAnalogInput(14, SIMULATOR_BATTERYLEVEL);
+
+  setup();
+  unsigned long start = millis();
+  while (millis() - start < seconds * 1000) {
+    loop();
+    if (isClockSimulated) {
+      Host::advanceClock(SIMULATOR_LOOPMICROS);
+    }
+  }
+
+  if (captureFile != nullptr) {
+    pixelBuffer.setCaptureOutput(nullptr);
+    fclose(captureFile);
+    delete captureOutput;
+  }
+
+  Host::setFlashFile(nullptr);
+  fflush(stdout);
+  return 0;
+}
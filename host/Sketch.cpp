@@ -0,0 +1,3 @@
+// Builds the sketch itself as a C++ file for the host.
+#include "Sketch.h"
+#include "../BlueToothLedSign.ino"
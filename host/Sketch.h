@@ -0,0 +1,34 @@
+// The Arduino IDE generates prototypes for the functions in the sketch.
+// This does the same for the host build, so the .ino compiles as plain C++.
+#include "Arduino.h"
+#include "PixelBuffer.h"
+#include "LoopProfiler.h"
+
+#ifndef HOST_SKETCH_H
+#define HOST_SKETCH_H
+
+void setup();
+void loop();
+void initializeIO();
+void initializeLightStyles();
+void initializeManualStyleDefinitions();
+void runBenchmarks();
+void startBLE();
+void restoreSettings();
+void saveSettings();
+void readBleSettings();
+byte isInRange(byte value, byte minValue, byte maxValue);
+void readManualStyleButtons();
+void resetManualStyleIndicators();
+void blinkLowPowerIndicator();
+void updateBrightness();
+void updateLEDs();
+void checkForLowPowerState();
+float getCalculatedBatteryVoltage();
+int getVoltageInputLevel();
+void emitTelemetry();
+
+// Globals from the sketch that the host programs use.
+extern PixelBuffer pixelBuffer;
+
+#endif
@@ -0,0 +1,97 @@
+#include "Adafruit_NeoPixel.h"
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t numPixels, int16_t pin, neoPixelType type) : m_pixels(numPixels * 3) {
+}
+
+void Adafruit_NeoPixel::show() {
+  // On the nRF52 the library waits for the PWM transfer to finish, 30us per pixel,
+  // so on the simulated clock the transfer takes that long too.
+  m_endTime = micros() + numPixels() * 30;
+  if (Host::isClockSimulated()) {
+    Host::advanceClock(numPixels() * 30);
+  }
+
+  m_hasShown = true;
+  m_showCount++;
+}
+
+bool Adafruit_NeoPixel::canShow() {
+  if (!m_hasShown) {
+    return true;
+  }
+
+  return (long)(micros() - m_endTime) >= 300;
+}
+
+void Adafruit_NeoPixel::clear() {
+  std::fill(m_pixels.begin(), m_pixels.end(), 0);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t pixel, uint32_t color) {
+  if (pixel >= numPixels()) {
+    return;
+  }
+
+  m_pixels[pixel * 3] = color >> 8;
+  m_pixels[pixel * 3 + 1] = color >> 16;
+  m_pixels[pixel * 3 + 2] = color;
+}
+
+uint32_t Adafruit_NeoPixel::ColorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
+  // The same integer math as the library.
+  uint8_t r, g, b;
+  hue = (hue * 1530L + 32768) / 65536;
+  if (hue < 510) {
+    b = 0;
+    if (hue < 255) {
+      r = 255;
+      g = hue;
+    } else {
+      r = 510 - hue;
+      g = 255;
+    }
+  } else if (hue < 1020) {
+    r = 0;
+    if (hue < 765) {
+      g = 255;
+      b = hue - 510;
+    } else {
+      g = 1020 - hue;
+      b = 255;
+    }
+  } else if (hue < 1530) {
+    g = 0;
+    if (hue < 1275) {
+      r = hue - 1020;
+      b = 255;
+    } else {
+      r = 255;
+      b = 1530 - hue;
+    }
+  } else {
+    r = 255;
+    g = b = 0;
+  }
+
+  uint32_t v1 = 1 + val;
+  uint16_t s1 = 1 + sat;
+  uint8_t s2 = 255 - sat;
+  return ((((((r * s1) >> 8) + s2) * v1) & 0xff00) << 8) |
+         (((((g * s1) >> 8) + s2) * v1) & 0xff00) |
+         (((((b * s1) >> 8) + s2) * v1) >> 8);
+}
+
+uint8_t Adafruit_NeoPixel::gamma8(uint8_t x) {
+  // The library's table is this curve, rounded.
+  static uint8_t table[256];
+  static bool isBuilt = false;
+  if (!isBuilt) {
+    for (int i = 0; i < 256; i++) {
+      table[i] = (uint8_t)(pow(i / 255.0, 2.6) * 255.0 + 0.5);
+    }
+
+    isBuilt = true;
+  }
+
+  return table[x];
+}
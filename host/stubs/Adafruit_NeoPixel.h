@@ -0,0 +1,44 @@
+// Stand-in for the Adafruit NeoPixel library. The pixels go nowhere, but the strip
+// keeps the same timing rules: a frame takes 30 usec per pixel to send, and the
+// next one can't start until the strip has latched (300 usec after that).
+#include <vector>
+#include "Arduino.h"
+
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+  public:
+    Adafruit_NeoPixel(uint16_t numPixels, int16_t pin, neoPixelType type);
+
+    void begin() {}
+    void show();
+    bool canShow();
+    void clear();
+    void setPixelColor(uint16_t pixel, uint32_t color);
+    uint8_t* getPixels() { return m_pixels.data(); }
+    uint16_t numPixels() { return m_pixels.size() / 3; }
+
+    // The number of frames sent so far.
+    unsigned long getShowCount() { return m_showCount; }
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+      return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+    static uint32_t ColorHSV(uint16_t hue, uint8_t sat = 255, uint8_t val = 255);
+    static uint8_t gamma8(uint8_t x);
+
+  private:
+    std::vector<uint8_t> m_pixels;
+    unsigned long m_endTime{0};
+    bool m_hasShown{false};
+    unsigned long m_showCount{0};
+};
+
+#endif
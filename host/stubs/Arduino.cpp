@@ -0,0 +1,164 @@
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <thread>
+#include "Arduino.h"
+
+HostSerial Serial;
+
+static bool s_isClockSimulated = false;
+static unsigned long long s_simulatedMicros = 0;
+static const std::chrono::steady_clock::time_point s_startTime = std::chrono::steady_clock::now();
+static std::map<int, int> s_digitalInputs;
+static std::map<int, int> s_analogInputs;
+
+unsigned long micros() {
+  if (s_isClockSimulated) {
+    return (unsigned long)s_simulatedMicros;
+  }
+
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_startTime).count();
+}
+
+unsigned long millis() {
+  if (s_isClockSimulated) {
+    return (unsigned long)(s_simulatedMicros / 1000);
+  }
+
+  return micros() / 1000;
+}
+
+void delay(unsigned long msec) {
+  delayMicroseconds(msec * 1000);
+}
+
+void delayMicroseconds(unsigned int usec) {
+  if (s_isClockSimulated) {
+    s_simulatedMicros += usec;
+    return;
+  }
+
+  std::this_thread::sleep_for(std::chrono::microseconds(usec));
+}
+
+void pinMode(int pin, int mode) {
+}
+
+void digitalWrite(int pin, int value) {
+}
+
+int digitalRead(int pin) {
+  auto input = s_digitalInputs.find(pin);
+  return input == s_digitalInputs.end() ? HIGH : input->second;
+}
+
+int analogRead(int pin) {
+  auto input = s_analogInputs.find(pin);
+  return input == s_analogInputs.end() ? 0 : input->second;
+}
+
+void Host::useSimulatedClock(bool isSimulated) {
+  if (isSimulated && !s_isClockSimulated) {
+    s_simulatedMicros = 0;
+  }
+
+  s_isClockSimulated = isSimulated;
+}
+
+bool Host::isClockSimulated() {
+  return s_isClockSimulated;
+}
+
+void Host::advanceClock(unsigned long usec) {
+  s_simulatedMicros += usec;
+}
+
+void Host::setDigitalInput(int pin, int value) {
+  s_digitalInputs[pin] = value;
+}
+
+void Host::setAnalogInput(int pin, int value) {
+  s_analogInputs[pin] = value;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t count = 0;
+  while (size--) {
+    count += write(*buffer++);
+  }
+
+  return count;
+}
+
+size_t Print::print(const String& value) {
+  return write((const uint8_t*)value.c_str(), value.length());
+}
+
+size_t Print::print(const char* value) {
+  return write((const uint8_t*)value, strlen(value));
+}
+
+size_t Print::print(char value) {
+  return write((uint8_t)value);
+}
+
+size_t Print::print(unsigned char value, int base) {
+  return printNumber(value, false, base);
+}
+
+size_t Print::print(int value, int base) {
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+  return printNumber(value, false, base);
+}
+
+size_t Print::print(long value, int base) {
+  // Like Arduino, only base 10 gets a minus sign.
+  if (value < 0 && base == DEC) {
+    return printNumber(-(unsigned long)value, true, base);
+  }
+
+  return printNumber((unsigned long)value, false, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return printNumber(value, false, base);
+}
+
+size_t Print::print(double value, int digits) {
+  char text[64];
+  snprintf(text, sizeof(text), "%.*f", digits, value);
+  return print(text);
+}
+
+size_t Print::println() {
+  // Arduino ends lines with "\r\n", but a plain newline reads better on the host.
+  return write((uint8_t)'\n');
+}
+
+size_t Print::printNumber(unsigned long value, bool isNegative, int base) {
+  char text[72];
+  char* end = text + sizeof(text);
+  char* start = end;
+  do {
+    int digit = value % base;
+    *--start = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value > 0);
+
+  if (isNegative) {
+    *--start = '-';
+  }
+
+  return write((const uint8_t*)start, end - start);
+}
+
+size_t HostSerial::write(uint8_t value) {
+  return fwrite(&value, 1, 1, stdout);
+}
+
+size_t HostSerial::write(const uint8_t* buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
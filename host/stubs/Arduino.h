@@ -0,0 +1,117 @@
+// Stand-in for the Arduino core, so the sketch can be built and run on a Linux host.
+// Only the parts of the API the sketch uses are here.
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+typedef uint8_t byte;
+
+#define PI 3.1415926535897932384626433832795
+#define TWO_PI 6.283185307179586476925286766559
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long msec);
+void delayMicroseconds(unsigned int usec);
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+int analogRead(int pin);
+
+// Hooks for host programs to control the stand-in hardware.
+namespace Host {
+  // By default the clock follows real time. The simulated clock starts at zero and only
+  // moves through advanceClock() and delay(), so runs are repeatable.
+  void useSimulatedClock(bool isSimulated);
+  bool isClockSimulated();
+  void advanceClock(unsigned long usec);
+
+  // Sets what digitalRead() and analogRead() return for a pin.
+  // Unset digital pins read HIGH (the buttons use pull-ups), and unset analog pins read 0.
+  void setDigitalInput(int pin, int value);
+  void setAnalogInput(int pin, int value);
+}
+
+class String {
+  public:
+    String() {}
+    String(const char* value) : m_value(value) {}
+    String(const std::string& value) : m_value(value) {}
+    String(char value) : m_value(1, value) {}
+    String(int value) : m_value(std::to_string(value)) {}
+    String(unsigned int value) : m_value(std::to_string(value)) {}
+    String(long value) : m_value(std::to_string(value)) {}
+    String(unsigned long value) : m_value(std::to_string(value)) {}
+
+    unsigned int length() const { return m_value.length(); }
+    const char* c_str() const { return m_value.c_str(); }
+    char charAt(unsigned int index) const { return index < m_value.length() ? m_value[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    void reserve(unsigned int size) { m_value.reserve(size); }
+
+    bool concat(const String& value) { m_value += value.m_value; return true; }
+    bool concat(const char* value) { m_value += value; return true; }
+    bool concat(char value) { m_value += value; return true; }
+    String& operator+=(const String& value) { concat(value); return *this; }
+    String operator+(const String& value) const { return String(m_value + value.m_value); }
+
+    bool operator==(const String& other) const { return m_value == other.m_value; }
+    bool operator!=(const String& other) const { return m_value != other.m_value; }
+
+  private:
+    std::string m_value;
+};
+
+// Same shape as the Arduino Print class: everything goes through write().
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+
+    size_t print(const String& value);
+    size_t print(const char* value);
+    size_t print(char value);
+    size_t print(unsigned char value, int base = DEC);
+    size_t print(int value, int base = DEC);
+    size_t print(unsigned int value, int base = DEC);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+    template <typename T> size_t println(T value, int format) { size_t n = print(value, format); return n + println(); }
+
+  private:
+    size_t printNumber(unsigned long value, bool isNegative, int base);
+};
+
+// The serial port writes to stdout.
+class HostSerial : public Print {
+  public:
+    void begin(unsigned long baud) {}
+    operator bool() { return true; }
+    size_t write(uint8_t value);
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+};
+
+extern HostSerial Serial;
+
+#endif
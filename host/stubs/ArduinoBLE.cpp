@@ -0,0 +1,124 @@
+#include <deque>
+#include "ArduinoBLE.h"
+
+BLELocalDevice BLE;
+
+struct PendingWrite {
+  BLECharacteristic characteristic;
+  std::vector<uint8_t> value;
+};
+
+static std::vector<BLECharacteristic> s_characteristics;
+static std::deque<PendingWrite> s_pendingWrites;
+
+BLECharacteristic::BLECharacteristic() : m_state(std::make_shared<State>()) {
+  m_state->properties = 0;
+  m_state->valueSize = 0;
+  m_state->isWritten = false;
+  m_state->writtenHandler = nullptr;
+}
+
+BLECharacteristic::BLECharacteristic(const char* uuid, uint8_t properties, int valueSize, bool fixedLength) : BLECharacteristic() {
+  m_state->uuid = uuid;
+  m_state->properties = properties;
+  m_state->valueSize = valueSize;
+}
+
+BLECharacteristic::BLECharacteristic(const char* uuid, uint8_t properties, const char* value) : BLECharacteristic(uuid, properties, strlen(value)) {
+  writeValue(value, strlen(value));
+}
+
+const char* BLECharacteristic::uuid() const {
+  return m_state->uuid.c_str();
+}
+
+uint8_t BLECharacteristic::properties() const {
+  return m_state->properties;
+}
+
+int BLECharacteristic::valueSize() const {
+  return m_state->valueSize;
+}
+
+int BLECharacteristic::valueLength() const {
+  return m_state->value.size();
+}
+
+const uint8_t* BLECharacteristic::value() const {
+  return m_state->value.data();
+}
+
+bool BLECharacteristic::written() {
+  bool isWritten = m_state->isWritten;
+  m_state->isWritten = false;
+  return isWritten;
+}
+
+int BLECharacteristic::writeValue(const uint8_t* value, int length, bool withResponse) {
+  // Like the real stack, values longer than the characteristic are cut off.
+  if (length > m_state->valueSize) {
+    length = m_state->valueSize;
+  }
+
+  m_state->value.assign(value, value + length);
+  return 1;
+}
+
+int BLECharacteristic::writeValue(const void* value, int length, bool withResponse) {
+  return writeValue((const uint8_t*)value, length, withResponse);
+}
+
+void BLECharacteristic::setEventHandler(int event, BLECharacteristicEventHandler handler) {
+  if (event == BLEWritten) {
+    m_state->writtenHandler = handler;
+  }
+}
+
+void BLEService::addCharacteristic(BLECharacteristic& characteristic) {
+  m_characteristics.push_back(characteristic);
+}
+
+void BLELocalDevice::addService(BLEService& service) {
+  for (BLECharacteristic& characteristic : service.m_characteristics) {
+    s_characteristics.push_back(characteristic);
+  }
+}
+
+void BLELocalDevice::poll() {
+  // Handlers can queue more writes (they shouldn't, but a test might), so take them one at a time.
+  while (!s_pendingWrites.empty()) {
+    PendingWrite pending = s_pendingWrites.front();
+    s_pendingWrites.pop_front();
+    pending.characteristic.writeValue(pending.value.data(), pending.value.size());
+    pending.characteristic.m_state->isWritten = true;
+    if (pending.characteristic.m_state->writtenHandler != nullptr) {
+      pending.characteristic.m_state->writtenHandler(BLEDevice(), pending.characteristic);
+    }
+  }
+}
+
+bool HostBLE::write(const char* uuid, const uint8_t* value, int length) {
+  for (BLECharacteristic& characteristic : s_characteristics) {
+    if (characteristic.m_state->uuid == uuid) {
+      s_pendingWrites.push_back(PendingWrite{characteristic, std::vector<uint8_t>(value, value + length)});
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::vector<uint8_t> HostBLE::read(const char* uuid) {
+  for (BLECharacteristic& characteristic : s_characteristics) {
+    if (characteristic.m_state->uuid == uuid) {
+      return characteristic.m_state->value;
+    }
+  }
+
+  return std::vector<uint8_t>();
+}
+
+void HostBLE::reset() {
+  s_characteristics.clear();
+  s_pendingWrites.clear();
+}
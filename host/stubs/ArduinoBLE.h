@@ -0,0 +1,139 @@
+// Stand-in for ArduinoBLE. Characteristics keep their values, and a host program can
+// play the part of a connected client through HostBLE: writes are queued and handed
+// to the characteristic's event handler on the next BLE.poll(), like the real stack.
+#include <memory>
+#include <vector>
+#include "Arduino.h"
+
+#ifndef HOST_ARDUINO_BLE_H
+#define HOST_ARDUINO_BLE_H
+
+enum BLEProperty {
+  BLEBroadcast = 0x01,
+  BLERead = 0x02,
+  BLEWriteWithoutResponse = 0x04,
+  BLEWrite = 0x08,
+  BLENotify = 0x10,
+  BLEIndicate = 0x20
+};
+
+enum BLECharacteristicEvent {
+  BLESubscribed = 0,
+  BLEUnsubscribed = 1,
+  BLEWritten = 3,
+  BLEUpdated = BLEWritten
+};
+
+class BLEDevice {
+};
+
+class BLECharacteristic;
+typedef void (*BLECharacteristicEventHandler)(BLEDevice device, BLECharacteristic characteristic);
+
+class BLECharacteristic {
+  public:
+    BLECharacteristic();
+    BLECharacteristic(const char* uuid, uint8_t properties, int valueSize, bool fixedLength = false);
+    BLECharacteristic(const char* uuid, uint8_t properties, const char* value);
+
+    const char* uuid() const;
+    uint8_t properties() const;
+    int valueSize() const;
+    int valueLength() const;
+    const uint8_t* value() const;
+    bool written();
+
+    int writeValue(const uint8_t* value, int length, bool withResponse = true);
+    int writeValue(const void* value, int length, bool withResponse = true);
+    int setValue(const uint8_t* value, int length) { return writeValue(value, length); }
+
+    void setEventHandler(int event, BLECharacteristicEventHandler handler);
+
+  protected:
+    struct State {
+      std::string uuid;
+      uint8_t properties;
+      int valueSize;
+      std::vector<uint8_t> value;
+      bool isWritten;
+      BLECharacteristicEventHandler writtenHandler;
+    };
+
+    // Copies of a characteristic (like the one passed to an event handler) share its state.
+    std::shared_ptr<State> m_state;
+
+    friend class BLELocalDevice;
+    friend class HostBLE;
+};
+
+template <typename T>
+class BLETypedCharacteristic : public BLECharacteristic {
+  public:
+    BLETypedCharacteristic(const char* uuid, unsigned int properties) : BLECharacteristic(uuid, properties, sizeof(T), true) {
+      T zero = T();
+      BLECharacteristic::writeValue((const uint8_t*)&zero, sizeof(T));
+    }
+
+    int writeValue(T value) { return BLECharacteristic::writeValue((const uint8_t*)&value, sizeof(T)); }
+    int setValue(T value) { return writeValue(value); }
+
+    T value() {
+      T result = T();
+      memcpy(&result, BLECharacteristic::value(), valueLength() < (int)sizeof(T) ? valueLength() : sizeof(T));
+      return result;
+    }
+};
+
+class BLEStringCharacteristic : public BLECharacteristic {
+  public:
+    BLEStringCharacteristic(const char* uuid, unsigned int properties, int valueSize) : BLECharacteristic(uuid, properties, valueSize) {}
+    int writeValue(const String& value) { return BLECharacteristic::writeValue((const uint8_t*)value.c_str(), value.length()); }
+    int setValue(const String& value) { return writeValue(value); }
+    String value() { return String(std::string((const char*)BLECharacteristic::value(), valueLength())); }
+};
+
+class BLEService {
+  public:
+    BLEService(const char* uuid) {}
+    void addCharacteristic(BLECharacteristic& characteristic);
+
+  private:
+    std::vector<BLECharacteristic> m_characteristics;
+    friend class BLELocalDevice;
+};
+
+class BLELocalDevice {
+  public:
+    int begin() { return 1; }
+    void end() {}
+    void setLocalName(const char* name) {}
+    void setAdvertisedService(BLEService& service) {}
+    void addService(BLEService& service);
+    int advertise() { return 1; }
+    void stopAdvertise() {}
+    bool connected() { return true; }
+    bool disconnect() { return true; }
+
+    // Hands any writes queued through HostBLE to their event handlers.
+    void poll();
+};
+
+extern BLELocalDevice BLE;
+
+// Plays the part of a connected client.
+class HostBLE {
+  public:
+    // Queues a client write. It's applied on the next BLE.poll().
+    // Returns false if no characteristic with the UUID has been added to a service.
+    static bool write(const char* uuid, const uint8_t* value, int length);
+
+    // Reads the current value of a characteristic, the way a client would.
+    static std::vector<uint8_t> read(const char* uuid);
+
+    // Forgets all the services, so a test can start over.
+    static void reset();
+};
+
+#include "BLETypedCharacteristics.h"
+
+#endif
@@ -0,0 +1,26 @@
+#include "ArduinoBLE.h"
+
+#ifndef HOST_BLE_TYPED_CHARACTERISTICS_H
+#define HOST_BLE_TYPED_CHARACTERISTICS_H
+
+class BLEByteCharacteristic : public BLETypedCharacteristic<byte> {
+  public:
+    BLEByteCharacteristic(const char* uuid, unsigned char properties) : BLETypedCharacteristic<byte>(uuid, properties) {}
+};
+
+class BLEUnsignedShortCharacteristic : public BLETypedCharacteristic<unsigned short> {
+  public:
+    BLEUnsignedShortCharacteristic(const char* uuid, unsigned char properties) : BLETypedCharacteristic<unsigned short>(uuid, properties) {}
+};
+
+class BLEUnsignedIntCharacteristic : public BLETypedCharacteristic<unsigned int> {
+  public:
+    BLEUnsignedIntCharacteristic(const char* uuid, unsigned char properties) : BLETypedCharacteristic<unsigned int>(uuid, properties) {}
+};
+
+class BLEFloatCharacteristic : public BLETypedCharacteristic<float> {
+  public:
+    BLEFloatCharacteristic(const char* uuid, unsigned char properties) : BLETypedCharacteristic<float>(uuid, properties) {}
+};
+
+#endif
@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "FlashIAP.h"
+
+#define HOST_FLASH_SIZE 0x100000
+#define HOST_FLASH_SECTORSIZE 4096
+#define HOST_FLASH_PAGESIZE 4
+
+static std::vector<uint8_t> s_flash(HOST_FLASH_SIZE, 0xFF);
+static FILE* s_flashFile = nullptr;
+
+// The steps left before the power is cut (if it's going to be), and the counts so far.
+static bool s_isPowerCutPending = false;
+static unsigned long s_stepsBeforePowerCut = 0;
+static bool s_isPowerCut = false;
+static unsigned long s_stepCount = 0;
+static unsigned long s_eraseCount = 0;
+
+// Takes a step, or cuts the power if there are none left. Returns false if the power was cut.
+static bool takeStep() {
+  if (s_isPowerCutPending && s_stepsBeforePowerCut-- == 0) {
+    s_isPowerCutPending = false;
+    s_isPowerCut = true;
+    return false;
+  }
+
+  s_stepCount++;
+  return true;
+}
+
+static void writeThrough(uint32_t address, uint32_t size) {
+  if (s_flashFile == nullptr || size == 0) {
+    return;
+  }
+
+  fseek(s_flashFile, address, SEEK_SET);
+  fwrite(&s_flash[address], 1, size, s_flashFile);
+  fflush(s_flashFile);
+}
+
+namespace mbed {
+
+int FlashIAP::init() {
+  return 0;
+}
+
+int FlashIAP::deinit() {
+  return 0;
+}
+
+int FlashIAP::read(void* buffer, uint32_t address, uint32_t size) {
+  if (s_isPowerCut || address > HOST_FLASH_SIZE || size > HOST_FLASH_SIZE - address) {
+    return -1;
+  }
+
+  memcpy(buffer, &s_flash[address], size);
+  return 0;
+}
+
+int FlashIAP::program(const void* buffer, uint32_t address, uint32_t size) {
+  if (s_isPowerCut) {
+    return -1;
+  }
+
+  if (address % HOST_FLASH_PAGESIZE != 0 || size % HOST_FLASH_PAGESIZE != 0
+    || address > HOST_FLASH_SIZE || size > HOST_FLASH_SIZE - address) {
+    return -1;
+  }
+
+  const uint8_t* bytes = (const uint8_t*)buffer;
+  for (uint32_t i = 0; i < size; i++) {
+    if (!takeStep()) {
+      // Only the low bits of the byte in progress made it.
+      s_flash[address + i] &= bytes[i] | 0xF0;
+      writeThrough(address, i + 1);
+      return -1;
+    }
+
+    s_flash[address + i] &= bytes[i];
+  }
+
+  writeThrough(address, size);
+  return 0;
+}
+
+int FlashIAP::erase(uint32_t address, uint32_t size) {
+  if (s_isPowerCut) {
+    return -1;
+  }
+
+  if (address % HOST_FLASH_SECTORSIZE != 0 || size % HOST_FLASH_SECTORSIZE != 0
+    || address > HOST_FLASH_SIZE || size > HOST_FLASH_SIZE - address) {
+    return -1;
+  }
+
+  for (uint32_t sector = 0; sector < size; sector += HOST_FLASH_SECTORSIZE) {
+    if (!takeStep()) {
+      // The sector is left half erased.
+      memset(&s_flash[address + sector], 0xFF, HOST_FLASH_SECTORSIZE / 2);
+      writeThrough(address, sector + HOST_FLASH_SECTORSIZE / 2);
+      return -1;
+    }
+
+    memset(&s_flash[address + sector], 0xFF, HOST_FLASH_SECTORSIZE);
+    s_eraseCount++;
+  }
+
+  writeThrough(address, size);
+  return 0;
+}
+
+uint32_t FlashIAP::get_page_size() const {
+  return HOST_FLASH_PAGESIZE;
+}
+
+uint32_t FlashIAP::get_sector_size(uint32_t address) const {
+  return HOST_FLASH_SECTORSIZE;
+}
+
+uint32_t FlashIAP::get_flash_start() const {
+  return 0;
+}
+
+uint32_t FlashIAP::get_flash_size() const {
+  return HOST_FLASH_SIZE;
+}
+
+uint8_t FlashIAP::get_erase_value() const {
+  return 0xFF;
+}
+
+}
+
+bool Host::setFlashFile(const char* path) {
+  if (s_flashFile != nullptr) {
+    fclose(s_flashFile);
+    s_flashFile = nullptr;
+  }
+
+  s_flash.assign(HOST_FLASH_SIZE, 0xFF);
+  if (path == nullptr) {
+    return true;
+  }
+
+  s_flashFile = fopen(path, "r+b");
+  if (s_flashFile != nullptr) {
+    // A short file is padded out with erased flash.
+    fread(s_flash.data(), 1, HOST_FLASH_SIZE, s_flashFile);
+  } else {
+    s_flashFile = fopen(path, "w+b");
+    if (s_flashFile == nullptr) {
+      return false;
+    }
+  }
+
+  writeThrough(0, HOST_FLASH_SIZE);
+  return true;
+}
+
+void Host::cutFlashPowerAfter(unsigned long stepCount) {
+  s_isPowerCutPending = true;
+  s_stepsBeforePowerCut = stepCount;
+}
+
+void Host::restoreFlashPower() {
+  s_isPowerCutPending = false;
+  s_isPowerCut = false;
+}
+
+bool Host::isFlashPowerCut() {
+  return s_isPowerCut;
+}
+
+unsigned long Host::getFlashStepCount() {
+  return s_stepCount;
+}
+
+unsigned long Host::getFlashEraseCount() {
+  return s_eraseCount;
+}
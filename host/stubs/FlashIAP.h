@@ -0,0 +1,49 @@
+// Stand-in for mbed's FlashIAP, laid out like the nRF52840: 1 MB of flash in 4 KB sectors,
+// programmed a word at a time. Programming can only clear bits, like real flash.
+// The flash can be kept in a file so it lasts between runs, and a test can cut the
+// power part way through a write to see what survives.
+#include <stdint.h>
+
+#ifndef HOST_FLASH_IAP_H
+#define HOST_FLASH_IAP_H
+
+namespace mbed {
+
+class FlashIAP {
+  public:
+    int init();
+    int deinit();
+    int read(void* buffer, uint32_t address, uint32_t size);
+    int program(const void* buffer, uint32_t address, uint32_t size);
+    int erase(uint32_t address, uint32_t size);
+    uint32_t get_page_size() const;
+    uint32_t get_sector_size(uint32_t address) const;
+    uint32_t get_flash_start() const;
+    uint32_t get_flash_size() const;
+    uint8_t get_erase_value() const;
+};
+
+}
+
+namespace Host {
+  // Keeps the flash in a file: it's loaded from the file (if there is one), and every
+  // program or erase is written straight through to it. Null goes back to erased memory.
+  // Returns false if the file couldn't be opened.
+  bool setFlashFile(const char* path);
+
+  // Lets this many more steps (programmed bytes or sector erases) complete, then cuts the power.
+  // The byte being programmed when the power goes is left with only some of its bits cleared,
+  // and a sector being erased is left half erased. After that the flash can't be read or
+  // written until restoreFlashPower().
+  void cutFlashPowerAfter(unsigned long stepCount);
+  void restoreFlashPower();
+  bool isFlashPowerCut();
+
+  // Gets the number of steps (programmed bytes and sector erases) completed so far.
+  unsigned long getFlashStepCount();
+
+  // Gets the number of sectors erased so far.
+  unsigned long getFlashEraseCount();
+}
+
+#endif
@@ -0,0 +1,101 @@
+// Plays a client writing settings much faster than the loop reads them, and checks every
+// write comes out of the queue once and in order, or is counted as dropped if the queue fills.
+#include <ArduinoBLE.h>
+#include "Bluetooth.h"
+#include "HostTest.h"
+
+static const char* const BrightnessUuid = "5eccb54e-465f-47f4-ac50-6735bfc0e730";
+static const char* const StyleUuid = "c99db9f7-1719-43db-ad86-d02d36b191b3";
+static const char* const SpeedUuid = "b975e425-62e4-4b08-a652-d64ad5097815";
+static const char* const SceneUuid = "6dbc7e1f-bafe-4d34-8ea3-cfc544da9b61";
+
+static Bluetooth btService;
+
+// Writes a byte setting, cycling through the characteristics so the order can be checked.
+static void writeSetting(int index) {
+  static const char* const uuids[] = { BrightnessUuid, StyleUuid, SpeedUuid };
+  uint8_t value = index & 0xFF;
+  HostBLE::write(uuids[index % 3], &value, 1);
+}
+
+static SettingType getWrittenType(int index) {
+  static const SettingType types[] = { SettingBrightness, SettingStyle, SettingSpeed };
+  return types[index % 3];
+}
+
+int main() {
+  btService.initialize();
+
+  // Bursts of up to a queue's worth of writes between polls, like a client that
+  // writes on every connection event while the loop is busy with a frame.
+  int written = 0;
+  int readCount = 0;
+  bool isInOrder = true;
+  for (int burst = 0; burst < 100; burst++) {
+    int burstSize = 1 + burst % SETTINGS_QUEUE_SIZE;
+    for (int i = 0; i < burstSize; i++) {
+      writeSetting(written++);
+    }
+
+    btService.poll();
+    SettingChange change;
+    while (btService.readSetting(&change)) {
+      if (change.type != getWrittenType(readCount) || change.value != (readCount & 0xFF)) {
+        isInOrder = false;
+      }
+
+      readCount++;
+    }
+  }
+
+  CHECK(readCount == written, "read %d settings, but %d were written", readCount, written);
+  CHECK(isInOrder, "the settings came out in a different order than they were written");
+  CHECK(btService.getDroppedSettingCount() == 0, "%lu settings were dropped", btService.getDroppedSettingCount());
+
+  // Scenes go through the queue whole, between the single settings around them.
+  writeSetting(0);
+  for (int i = 0; i < 5; i++) {
+    uint8_t scene[BLUETOOTH_H_SCENELENGTH] = { 1, 2, 3, 4, (uint8_t)i };
+    HostBLE::write(SceneUuid, scene, sizeof(scene));
+  }
+
+  writeSetting(1);
+  btService.poll();
+  SettingChange change;
+  CHECK(btService.readSetting(&change) && change.type == SettingBrightness, "the first setting should come before the scenes");
+  for (int i = 0; i < 5; i++) {
+    static const SettingType sceneTypes[] = { SettingStyle, SettingPattern, SettingSpeed, SettingStep, SettingBrightness };
+    for (int j = 0; j < BLUETOOTH_H_SCENELENGTH; j++) {
+      uint8_t expected = j < 4 ? j + 1 : i;
+      CHECK(btService.readSetting(&change) && change.type == sceneTypes[j] && change.value == expected,
+        "scene %d, setting %d: got type %d value %d", i, j, change.type, change.value);
+    }
+  }
+
+  CHECK(btService.readSetting(&change) && change.type == SettingStyle && change.value == 1, "the last setting should come after the scenes");
+  CHECK(!btService.readSetting(&change), "there should be nothing left in the queue");
+
+  // More writes than the queue holds: the oldest are kept, the rest are counted.
+  int overflow = 8;
+  for (int i = 0; i < SETTINGS_QUEUE_SIZE + overflow; i++) {
+    writeSetting(i);
+  }
+
+  btService.poll();
+  readCount = 0;
+  isInOrder = true;
+  while (btService.readSetting(&change)) {
+    if (change.type != getWrittenType(readCount) || change.value != readCount) {
+      isInOrder = false;
+    }
+
+    readCount++;
+  }
+
+  CHECK(readCount == SETTINGS_QUEUE_SIZE, "read %d settings from a full queue, expected %d", readCount, SETTINGS_QUEUE_SIZE);
+  CHECK(isInOrder, "the settings kept from a full queue came out of order");
+  CHECK(btService.getDroppedSettingCount() == overflow, "%lu settings were counted as dropped, expected %d",
+    btService.getDroppedSettingCount(), overflow);
+
+  return finishTest();
+}
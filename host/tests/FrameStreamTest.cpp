@@ -0,0 +1,129 @@
+// Streams frames through the host encoder and the sign's decoder, and checks each one
+// comes out exactly as it went in, whichever encoding it was sent with. A frame with a
+// lost packet must be dropped whole, and the sign must pick up again from a full frame.
+#include <stdlib.h>
+#include "HostTest.h"
+#include "FrameEncoder.h"
+#include "FrameStream.h"
+#include "PixelBuffer.h"
+
+static PixelBuffer pixelBuffer(-1);
+static FrameStream frameStream;
+static FrameEncoder encoder;
+static uint32_t colors[ActiveLayout::PixelCount];
+
+static void sendPackets(const std::vector<FramePacket>& packets) {
+  for (const FramePacket& packet : packets) {
+    frameStream.receivePacket(packet.data(), packet.size());
+  }
+}
+
+// Sends the frame in colors and checks the sign shows it unchanged.
+static void checkRoundTrip(const char* name, FrameEncoding expectedEncoding) {
+  std::vector<FramePacket> packets = encoder.encodeFrame(colors);
+  CHECK(encoder.getLastEncoding() == expectedEncoding, "%s: sent with encoding %d, expected %d",
+    name, encoder.getLastEncoding(), expectedEncoding);
+
+  unsigned long frameCount = frameStream.getFrameCount();
+  sendPackets(packets);
+  CHECK(frameStream.hasNewFrame(), "%s: the frame didn't arrive", name);
+  CHECK(frameStream.getFrameCount() == frameCount + 1, "%s: the frame count didn't go up by one", name);
+
+  frameStream.copyFrame(&pixelBuffer);
+  int mismatches = 0;
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    if (pixelBuffer.getPixel(i) != colors[i]) {
+      mismatches++;
+    }
+  }
+
+  CHECK(mismatches == 0, "%s: %d pixels came out different", name, mismatches);
+}
+
+static uint32_t getRandomColor() {
+  return ((uint32_t)rand() & 0xFFFFFF);
+}
+
+int main() {
+  srand(3181);
+
+  // One color: a palette entry and a handful of runs.
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    colors[i] = 0x00FF8000;
+  }
+
+  checkRoundTrip("solid", FrameEncodingRuns);
+
+  // Long stripes of a few colors.
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    colors[i] = (i / 20) % 2 == 0 ? 0x000000FF : 0x0000FF00;
+  }
+
+  checkRoundTrip("stripes", FrameEncodingRuns);
+
+  // A few colors with no runs, which packs two pixels to a byte.
+  uint32_t smallPalette[12];
+  for (uint32_t& color : smallPalette) {
+    color = getRandomColor();
+  }
+
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    colors[i] = smallPalette[(i * 7 + i / 3) % 12];
+  }
+
+  checkRoundTrip("small palette", FrameEncodingIndexed4);
+
+  // Up to 256 colors takes a byte per pixel.
+  uint32_t largePalette[100];
+  for (uint32_t& color : largePalette) {
+    color = getRandomColor();
+  }
+
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    colors[i] = largePalette[rand() % 100];
+  }
+
+  checkRoundTrip("large palette", FrameEncodingIndexed8);
+
+  // Every pixel different has to go raw.
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    colors[i] = getRandomColor();
+  }
+
+  checkRoundTrip("raw", FrameEncodingRaw);
+
+  // An odd number of changed pixels in the middle of the frame, so the packed
+  // indices can't run over the pixel after them.
+  for (int i = 101; i < 106; i++) {
+    colors[i] = smallPalette[i % 2];
+  }
+
+  checkRoundTrip("odd span", FrameEncodingIndexed4);
+
+  // Nothing changed.
+  checkRoundTrip("unchanged", FrameEncodingRaw);
+
+  // Lose a packet from the middle of a frame: it's never shown, and it counts as dropped.
+  for (int i = 0; i < ActiveLayout::PixelCount; i++) {
+    colors[i] = getRandomColor();
+  }
+
+  std::vector<FramePacket> packets = encoder.encodeFrame(colors);
+  CHECK(packets.size() > 2, "a raw frame should take several packets, not %d", (int)packets.size());
+  packets.erase(packets.begin() + packets.size() / 2);
+  unsigned long droppedCount = frameStream.getDroppedFrameCount();
+  sendPackets(packets);
+  CHECK(!frameStream.hasNewFrame(), "a frame with a missing packet was shown");
+  CHECK(frameStream.getDroppedFrameCount() == droppedCount + 1, "the frame with a missing packet wasn't counted as dropped");
+
+  // The encoder has to start over, since the sign never got that frame.
+  encoder.reset();
+  for (int i = 0; i < 40; i++) {
+    colors[i] = 0;
+  }
+
+  checkRoundTrip("after a lost packet", FrameEncodingRaw);
+  CHECK(frameStream.getDroppedFrameCount() == droppedCount + 1, "a good frame was counted as dropped");
+
+  return finishTest();
+}
@@ -0,0 +1,30 @@
+// A minimal test harness for the host tests. Each test is a plain program:
+// CHECK records a failure (and keeps going), and finishTest() sets the exit code for ctest.
+#include <stdio.h>
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+static int s_failureCount = 0;
+
+#define CHECK(condition, ...) \
+  do { \
+    if (!(condition)) { \
+      s_failureCount++; \
+      printf("FAIL %s:%d: %s: ", __FILE__, __LINE__, #condition); \
+      printf(__VA_ARGS__); \
+      printf("\n"); \
+    } \
+  } while (0)
+
+static int finishTest() {
+  if (s_failureCount > 0) {
+    printf("%d check(s) failed.\n", s_failureCount);
+    return 1;
+  }
+
+  printf("All checks passed.\n");
+  return 0;
+}
+
+#endif
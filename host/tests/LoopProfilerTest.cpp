@@ -0,0 +1,54 @@
+// Checks the loop profiler's histogram: a single stutter anywhere in the interval shows up,
+// the percentiles land within a bucket of the real value, and reset() starts over.
+#include "HostTest.h"
+#include "LoopProfiler.h"
+
+static void getTimes(LoopProfiler& profiler, LoopPhase phase, uint16_t* times) {
+  uint8_t summary[LOOP_PROFILER_SUMMARYSIZE];
+  profiler.getSummary(summary);
+  CHECK(summary[0] == LoopPhaseCount, "the summary should start with the phase count");
+  for (int i = 0; i < 4; i++) {
+    const uint8_t* value = summary + 1 + phase * 8 + i * 2;
+    times[i] = value[0] | (value[1] << 8);
+  }
+}
+
+int main() {
+  LoopProfiler profiler;
+
+  // One early stutter, then far more normal loops than the old 64-sample ring kept.
+  profiler.record(LoopPhaseDisplay, 25000);
+  for (int i = 0; i < 5000; i++) {
+    profiler.record(LoopPhaseDisplay, 400 + i % 200);
+  }
+
+  uint16_t times[4];
+  getTimes(profiler, LoopPhaseDisplay, times);
+  CHECK(times[0] == 400, "min is %u, expected 400", times[0]);
+  CHECK(times[1] >= 499 && times[1] <= 499 + 499 / 8, "p50 is %u, expected about 499", times[1]);
+  CHECK(times[2] >= 597 && times[2] <= 597 + 597 / 8, "p99 is %u, expected about 597", times[2]);
+  CHECK(times[3] == 25000, "max is %u; the early stutter was lost", times[3]);
+
+  // The phases are kept separately, and long times are capped.
+  profiler.record(LoopPhaseBle, 100000);
+  getTimes(profiler, LoopPhaseBle, times);
+  CHECK(times[0] == 65535 && times[3] == 65535, "a long time should be capped at 65535, got %u/%u", times[0], times[3]);
+  getTimes(profiler, LoopPhaseStyle, times);
+  CHECK(times[0] == 0 && times[1] == 0 && times[2] == 0 && times[3] == 0, "a phase with no samples should report zeros");
+
+  // Small times are exact.
+  for (int i = 0; i < 100; i++) {
+    profiler.record(LoopPhaseButtons, i < 98 ? 3 : 9);
+  }
+
+  getTimes(profiler, LoopPhaseButtons, times);
+  CHECK(times[1] == 3 && times[2] == 9, "p50/p99 are %u/%u, expected 3/9", times[1], times[2]);
+
+  // After a reset, the stutter is gone.
+  profiler.reset();
+  profiler.record(LoopPhaseDisplay, 450);
+  getTimes(profiler, LoopPhaseDisplay, times);
+  CHECK(times[0] == 450 && times[3] == 450, "after reset min/max are %u/%u, expected 450", times[0], times[3]);
+
+  return finishTest();
+}
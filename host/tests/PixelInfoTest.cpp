@@ -0,0 +1,38 @@
+// Checks the generated PixelInfo tables in PixelLayouts.h still match their block maps,
+// and that PixelBuffer reports them.
+#include <vector>
+#include "HostTest.h"
+#include "PixelBuffer.h"
+#include "PixelInfoGenerator.h"
+
+static void checkLayout(const char* name, const PixelBlockMap& rows, const PixelBlockMap& columns, const PixelBlockMap& digits,
+  uint16_t pixelCount, const PixelInfo* table, size_t tableSize) {
+  CHECK(tableSize == pixelCount, "%s has %d PixelInfo entries for %d pixels", name, (int)tableSize, pixelCount);
+  std::vector<PixelInfo> expected(pixelCount);
+  buildPixelInfo(rows, columns, digits, pixelCount, expected.data());
+  for (int i = 0; i < pixelCount && i < tableSize; i++) {
+    CHECK(memcmp(&table[i], &expected[i], sizeof(PixelInfo)) == 0,
+      "%s pixel %d is out of date; regenerate the table with GeneratePixelInfo", name, i);
+  }
+}
+
+int main() {
+  checkLayout("SignLayout", SignLayout::Rows, SignLayout::Columns, SignLayout::Digits, SignLayout::PixelCount,
+    SignLayout::Pixels, sizeof(SignLayout::Pixels) / sizeof(PixelInfo));
+  checkLayout("TestRingLayout", TestRingLayout::Rows, TestRingLayout::Columns, TestRingLayout::Digits, TestRingLayout::PixelCount,
+    TestRingLayout::Pixels, sizeof(TestRingLayout::Pixels) / sizeof(PixelInfo));
+
+  PixelBuffer pixelBuffer(0);
+  for (unsigned int i = 0; i < pixelBuffer.getPixelCount(); i++) {
+    PixelInfo info = pixelBuffer.getPixelInfo(i);
+    CHECK(memcmp(&info, &ActiveLayout::Pixels[i], sizeof(PixelInfo)) == 0, "getPixelInfo(%u) doesn't match the table", i);
+    CHECK(pixelBuffer.getPixelColumn(i) == info.column && pixelBuffer.getPixelRow(i) == info.row && pixelBuffer.getPixelDigit(i) == info.digit,
+      "the block getters for pixel %u don't match getPixelInfo", i);
+  }
+
+  PixelInfo outside = pixelBuffer.getPixelInfo(pixelBuffer.getPixelCount());
+  CHECK(outside.column == PixelBuffer::NoBlock && outside.row == PixelBuffer::NoBlock && outside.digit == PixelBuffer::NoBlock,
+    "a pixel past the end should be in no block");
+
+  return finishTest();
+}
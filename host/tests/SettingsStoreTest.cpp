@@ -0,0 +1,170 @@
+// Cuts the power at every step of saving the settings (each programmed byte, and each sector
+// erase), then restarts from the flash file and checks the store comes back with either the
+// old settings or the new ones, never a mix or nothing, and can still save afterwards.
+#include <stdio.h>
+#include <vector>
+#include "HostTest.h"
+#include "SettingsStore.h"
+
+static const char* const FlashPath = "settings_store_flash.bin";
+static const char* const BasePath = "settings_store_base.bin";
+
+// A scene that's different for every n.
+static SceneSettings getScene(int n) {
+  return SceneSettings{ (byte)(n % 7), (byte)(n % 5), (byte)(1 + n % 100), (byte)(1 + n / 100), (byte)(n * 3) };
+}
+
+static bool isScene(const SceneSettings& scene, int n) {
+  SceneSettings expected = getScene(n);
+  return memcmp(&scene, &expected, sizeof(SceneSettings)) == 0;
+}
+
+static std::vector<ManualSelection> s_manualStyles[2] = {
+  { ManualSelection(1, 100, 0, 50, 50), ManualSelection(2, 80, 1, 40, 60) },
+  { ManualSelection(3, 60, 2, 30, 70) }
+};
+
+static bool hasManualStyles(SettingsStore& store) {
+  std::vector<ManualSelection> definitions[2];
+  if (!store.getManualStyles(definitions, 2)) {
+    return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (definitions[i].size() != s_manualStyles[i].size()) {
+      return false;
+    }
+
+    for (int j = 0; j < definitions[i].size(); j++) {
+      const ManualSelection& a = definitions[i][j];
+      const ManualSelection& b = s_manualStyles[i][j];
+      if (a.StyleIndex != b.StyleIndex || a.Brightness != b.Brightness || a.PatternIndex != b.PatternIndex
+        || a.Step != b.Step || a.Speed != b.Speed) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+static void copyFile(const char* fromPath, const char* toPath) {
+  FILE* from = fopen(fromPath, "rb");
+  FILE* to = fopen(toPath, "wb");
+  char buffer[4096];
+  size_t size;
+  while ((size = fread(buffer, 1, sizeof(buffer), from)) > 0) {
+    fwrite(buffer, 1, size, to);
+  }
+
+  fclose(from);
+  fclose(to);
+}
+
+// Saves scene n. Returns false if the power went out part way through.
+static bool saveScene(SettingsStore& store, int n) {
+  store.setScene(getScene(n));
+  store.update();
+  return !Host::isFlashPowerCut();
+}
+
+// Starts with baseCount scenes (and the manual styles, if there are any) already saved,
+// then cuts the power at each step of saving newCount more.
+static void checkTornWrites(const char* name, int baseCount, int newCount) {
+  remove(FlashPath);
+  Host::setFlashFile(FlashPath);
+  {
+    SettingsStore store;
+    store.initialize();
+    if (baseCount > 0) {
+      store.setManualStyles(s_manualStyles, 2);
+    }
+
+    for (int i = 0; i < baseCount; i++) {
+      saveScene(store, i);
+    }
+  }
+
+  Host::setFlashFile(nullptr);
+  copyFile(FlashPath, BasePath);
+
+  // Save them once with the power on, to count the steps.
+  Host::setFlashFile(FlashPath);
+  unsigned long startSteps = Host::getFlashStepCount();
+  unsigned long startErases = Host::getFlashEraseCount();
+  {
+    SettingsStore store;
+    store.initialize();
+    for (int i = 0; i < newCount; i++) {
+      saveScene(store, baseCount + i);
+    }
+  }
+
+  unsigned long stepCount = Host::getFlashStepCount() - startSteps;
+  bool hasErase = Host::getFlashEraseCount() > startErases;
+  printf("%s: %lu steps, %s a sector erase.\n", name, stepCount, hasErase ? "including" : "without");
+
+  int failureCount = s_failureCount;
+  for (unsigned long cut = 0; cut < stepCount && s_failureCount == failureCount; cut++) {
+    Host::setFlashFile(nullptr);
+    copyFile(BasePath, FlashPath);
+    Host::setFlashFile(FlashPath);
+    Host::cutFlashPowerAfter(cut);
+
+    // The last scene that was completely saved, or -1 if there isn't one yet.
+    int lastSaved = baseCount - 1;
+    {
+      SettingsStore store;
+      store.initialize();
+      for (int i = 0; i < newCount && saveScene(store, baseCount + i); i++) {
+        lastSaved = baseCount + i;
+      }
+    }
+
+    CHECK(Host::isFlashPowerCut(), "%s, cut at step %lu: the power never went out", name, cut);
+
+    // Power back on, and restart from what made it into the file.
+    Host::restoreFlashPower();
+    Host::setFlashFile(FlashPath);
+    SettingsStore store;
+    bool hasSettings = store.initialize();
+    SceneSettings scene;
+    bool hasScene = store.getScene(&scene);
+    if (lastSaved >= 0) {
+      CHECK(hasSettings && hasScene, "%s, cut at step %lu: the saved scene was lost", name, cut);
+    }
+
+    if (hasScene) {
+      CHECK(isScene(scene, lastSaved) || isScene(scene, lastSaved + 1),
+        "%s, cut at step %lu: got a scene that wasn't saved (last saved was %d)", name, cut, lastSaved);
+    }
+
+    if (baseCount > 0) {
+      CHECK(hasManualStyles(store), "%s, cut at step %lu: the manual styles were lost", name, cut);
+    }
+
+    // It still has to save after the damage.
+    CHECK(saveScene(store, 1000), "%s, cut at step %lu: the power went out again", name, cut);
+    SettingsStore restarted;
+    Host::setFlashFile(FlashPath);
+    CHECK(restarted.initialize() && restarted.getScene(&scene) && isScene(scene, 1000),
+      "%s, cut at step %lu: a scene saved after the power cut didn't come back", name, cut);
+  }
+
+  Host::setFlashFile(nullptr);
+  remove(FlashPath);
+  remove(BasePath);
+}
+
+int main() {
+  // The very first save, onto erased flash.
+  checkTornWrites("first save", 0, 2);
+
+  // Records appended to a sector with room to spare.
+  checkTornWrites("append", 3, 3);
+
+  // Enough saves to fill the sector, so the settings move to the other one part way through.
+  checkTornWrites("sector move", 240, 30);
+
+  return finishTest();
+}
@@ -0,0 +1,69 @@
+// Checks the integer speed/step mappings against the floating-point mappings they replaced,
+// for every speed and step from 1 to 100.
+#include "HostTest.h"
+#include "RainbowStyle.h"
+#include "TwoColorStyle.h"
+
+// The mappings as they were, with m_speed/m_step passed in.
+static int oldRainbowIterationDelay(byte speed) {
+  int minDelay = 5;
+  int maxDelay = 500;
+  double m = (maxDelay - minDelay)/-99.0;
+  double b = maxDelay - m;
+  int delay = speed*m + b;
+  return delay;
+}
+
+static int oldRainbowHueIncrement(byte step) {
+  int maxInc = 1000;
+  int minInc = 5;
+  int maxStep = 100;
+  int minStep = 1;
+  double m = (double)(maxInc - minInc)/(maxStep - minStep);
+  double b = minInc - m;
+  int inc = step*m + b;
+  return inc;
+}
+
+static int oldTwoColorIterationDelay(byte speed) {
+  int minDelay = 20;
+  int maxDelay = 800;
+  int minSpeed = 100;  // Yes, reversed.  100 correlates to "fastest", ie, min delay
+  int maxSpeed = 1;
+  double m = (double)(maxDelay - minDelay)/(maxSpeed - minSpeed);
+  double b = maxDelay - m;
+  int delay = speed*m + b;
+  return delay;
+}
+
+static int oldTwoColorModulus(byte step) {
+  int minMod = 2;
+  int maxMod = 10;
+  int minStep = 1;
+  int maxStep = 100;
+  double midStep = (double)(maxStep - minStep) / 2.0;
+  // Arduino's abs() is a macro, so this was the absolute value of the double.
+  int x = fabs(step - midStep);
+  if (midStep - x < 5) {
+    return -1;
+  }
+  double m = (double)(maxMod - minMod)/(midStep - minStep);
+  double b = minMod;
+  int mod = x*m + b;
+  return mod;
+}
+
+int main() {
+  for (int value = 1; value <= 100; value++) {
+    CHECK(RainbowStyle::getIterationDelay(value) == oldRainbowIterationDelay(value),
+      "Rainbow delay at speed %d: %d, was %d", value, RainbowStyle::getIterationDelay(value), oldRainbowIterationDelay(value));
+    CHECK(RainbowStyle::getHueIncrement(value) == oldRainbowHueIncrement(value),
+      "Rainbow hue increment at step %d: %d, was %d", value, RainbowStyle::getHueIncrement(value), oldRainbowHueIncrement(value));
+    CHECK(TwoColorStyle::getIterationDelay(value) == oldTwoColorIterationDelay(value),
+      "TwoColor delay at speed %d: %d, was %d", value, TwoColorStyle::getIterationDelay(value), oldTwoColorIterationDelay(value));
+    CHECK(TwoColorStyle::getModulus(value) == oldTwoColorModulus(value),
+      "TwoColor modulus at step %d: %d, was %d", value, TwoColorStyle::getModulus(value), oldTwoColorModulus(value));
+  }
+
+  return finishTest();
+}
@@ -0,0 +1,137 @@
+// Checks that RainbowStyle::reset and TwoColorStyle::reset, which set each block's color
+// directly, leave exactly the same pixels as the shift-based resets they replaced.
+// Every pattern and step is tried, starting from each pattern's leftover state, and the
+// first update after the reset is compared too, to make sure the block rings line up.
+//
+// Both versions run on the current block tables. Pixel 280 used to be in two rows, which
+// made its color depend on the order of the shifts; that was fixed with the block rings,
+// so it isn't an exception here.
+#include <vector>
+#include "HostTest.h"
+#include "PixelBuffer.h"
+#include "LightStyle.h"
+#include "RainbowStyle.h"
+#include "TwoColorStyle.h"
+#include "HueWheel.h"
+
+#define STYLE_RESET_TEST_PATTERNS 7
+
+static PixelBuffer newBuffer(-1);
+static PixelBuffer oldBuffer(-1);
+
+// LightStyle::shiftColorUsingPattern, for the buffer the old reset runs on.
+static void shiftUsingPattern(PixelBuffer* buffer, int pattern, uint32_t color) {
+  switch (pattern) {
+    case 1: buffer->shiftColumnsRight(color); return;
+    case 2: buffer->shiftColumnsLeft(color); return;
+    case 3: buffer->shiftRowsUp(color); return;
+    case 4: buffer->shiftRowsDown(color); return;
+    case 5: buffer->shiftDigitsRight(color); return;
+    case 6: buffer->shiftLineRight(color); return;
+    default:
+      for (unsigned int i = 0; i < buffer->getPixelCount(); i++) {
+        buffer->setPixel(i, color);
+      }
+  }
+}
+
+static int getBlockCount(int pattern) {
+  switch (pattern) {
+    case 1: case 2: return newBuffer.getColumnCount();
+    case 3: case 4: return newBuffer.getRowCount();
+    case 5: case 6: return newBuffer.getDigitCount();
+    default: return 1;
+  }
+}
+
+// Leaves both buffers in the same state, as if a style had been running with the previous pattern.
+static void prepareBuffers(int previousPattern) {
+  for (PixelBuffer* buffer : { &newBuffer, &oldBuffer }) {
+    for (unsigned int i = 0; i < buffer->getPixelCount(); i++) {
+      buffer->setPixel(i, (i * 2654435761u) & 0xFFFFFF);
+    }
+
+    for (uint32_t i = 0; i < 5; i++) {
+      shiftUsingPattern(buffer, previousPattern, 0x010203 * (i + 1));
+    }
+  }
+}
+
+static bool isSameFrame() {
+  std::vector<uint32_t> newPixels(newBuffer.getPixelCount());
+  std::vector<uint32_t> oldPixels(oldBuffer.getPixelCount());
+  newBuffer.getPixels(newPixels.data());
+  oldBuffer.getPixels(oldPixels.data());
+  return newPixels == oldPixels;
+}
+
+static void checkRainbow(int previousPattern, int pattern, int step) {
+  prepareBuffers(previousPattern);
+  RainbowStyle style("Rainbow", &newBuffer);
+  style.setSpeed(100);
+  style.setStep(step);
+  style.setPattern(pattern);
+  style.reset();
+
+  // The old reset: shift in one hue per block, except the last.
+  uint16_t hue = 0;
+  uint16_t increment = RainbowStyle::getHueIncrement(step);
+  for (int i = 0; i < getBlockCount(pattern) - 1; i++) {
+    shiftUsingPattern(&oldBuffer, pattern, HueWheel::getColor(hue));
+    hue += increment;
+  }
+
+  CHECK(isSameFrame(), "Rainbow reset differs: pattern %d, step %d, after pattern %d", pattern, step, previousPattern);
+
+  style.update();
+  shiftUsingPattern(&oldBuffer, pattern, HueWheel::getColor(hue));
+  CHECK(isSameFrame(), "Rainbow update after reset differs: pattern %d, step %d, after pattern %d", pattern, step, previousPattern);
+}
+
+static void checkTwoColor(int previousPattern, int pattern, int step) {
+  uint32_t blue = Adafruit_NeoPixel::Color(0, 0, 255);
+  uint32_t pink = Adafruit_NeoPixel::Color(230, 22, 161);
+  prepareBuffers(previousPattern);
+  TwoColorStyle style("Blue-Pink", blue, pink, &newBuffer);
+  style.setSpeed(100);
+  style.setStep(step);
+  style.setPattern(pattern);
+  style.reset();
+
+  // The old reset: shift in a color for every block.
+  uint32_t primaryColor = step > 50 ? pink : blue;
+  uint32_t secondaryColor = step > 50 ? blue : pink;
+  int mod = TwoColorStyle::getModulus(step);
+  for (int i = 0; i < getBlockCount(pattern); i++) {
+    shiftUsingPattern(&oldBuffer, pattern, mod > 0 && i % mod == 0 ? secondaryColor : primaryColor);
+  }
+
+  CHECK(isSameFrame(), "TwoColor reset differs: pattern %d, step %d, after pattern %d", pattern, step, previousPattern);
+
+  // The first update shifts in the secondary color (iteration 0), twice for rows and columns.
+  style.update();
+  uint32_t newColor = mod > 0 ? secondaryColor : primaryColor;
+  shiftUsingPattern(&oldBuffer, pattern, newColor);
+  if (pattern >= 1 && pattern <= 4) {
+    shiftUsingPattern(&oldBuffer, pattern, newColor);
+  }
+
+  CHECK(isSameFrame(), "TwoColor update after reset differs: pattern %d, step %d, after pattern %d", pattern, step, previousPattern);
+}
+
+int main() {
+  Host::useSimulatedClock(true);
+  newBuffer.initialize();
+  oldBuffer.initialize();
+
+  for (int previousPattern = 0; previousPattern < STYLE_RESET_TEST_PATTERNS; previousPattern++) {
+    for (int pattern = 0; pattern < STYLE_RESET_TEST_PATTERNS; pattern++) {
+      for (int step = 1; step <= 100; step++) {
+        checkRainbow(previousPattern, pattern, step);
+        checkTwoColor(previousPattern, pattern, step);
+      }
+    }
+  }
+
+  return finishTest();
+}
@@ -0,0 +1,137 @@
+// Checks that a cross-fade starts from what's on the sign: the style's pixels with every
+// layer on top, including a fade still in progress and a layer covering the style.
+#include <vector>
+#include "HostTest.h"
+#include "PixelBuffer.h"
+#include "StyleTransition.h"
+#include "PixelLayer.h"
+#include "RainbowStyle.h"
+#include "TwoColorStyle.h"
+#include "SingleColorStyle.h"
+
+// Keeps the pixel bytes of the last frame sent to the strip.
+class FrameCapture : public Print {
+  public:
+    std::vector<uint8_t> frame;
+    size_t write(uint8_t value) { return write(&value, 1); }
+    size_t write(const uint8_t* buffer, size_t size) {
+      // Each frame is a 14-byte header, then the pixel bytes in one write.
+      if (size > 14) {
+        frame.assign(buffer, buffer + size);
+      }
+
+      return size;
+    }
+};
+
+static PixelBuffer pixelBuffer(-1);
+static PixelBuffer referenceBuffer(-1);
+static StyleTransition transition(&pixelBuffer);
+static PixelLayer cover(BlendMode::Over);
+static FrameCapture capture;
+
+static const std::vector<uint8_t>& displayFrame() {
+  // Far enough apart for the strip to latch and the frame period to pass.
+  Host::advanceClock(20000);
+  pixelBuffer.displayPixels();
+  return capture.frame;
+}
+
+static std::vector<uint8_t> getReferenceFrame() {
+  // The output is unscaled (no gamma, full brightness), so it's the colors in GRB order.
+  std::vector<uint8_t> frame;
+  for (unsigned int i = 0; i < referenceBuffer.getPixelCount(); i++) {
+    uint32_t color = referenceBuffer.getPixel(i);
+    frame.push_back(color >> 8);
+    frame.push_back(color >> 16);
+    frame.push_back(color);
+  }
+
+  return frame;
+}
+
+static void checkBlendedStart() {
+  transition.setDuration(500);
+  RainbowStyle first("First", &pixelBuffer);
+  TwoColorStyle second("Second", Adafruit_NeoPixel::Color(0, 0, 255), Adafruit_NeoPixel::Color(230, 22, 161), &pixelBuffer);
+  SingleColorStyle third("Third", Adafruit_NeoPixel::Color(255, 50, 0), &pixelBuffer);
+  first.setPattern(1);
+  second.setPattern(3);
+
+  first.reset();
+  displayFrame();
+  transition.start();
+  second.reset();
+  Host::advanceClock(230000);
+  transition.update();
+  second.update();
+  std::vector<uint8_t> halfway = displayFrame();
+
+  // Changing again halfway through starts from the half-faded frame, with no jump.
+  transition.start();
+  third.reset();
+  std::vector<uint8_t> restarted = displayFrame();
+  CHECK(restarted == halfway, "the second fade didn't start from the half-faded frame");
+
+  // Once the fade is over, only the new style is left.
+  Host::advanceClock(500000);
+  transition.update();
+  CHECK(!transition.isActive(), "the fade should be over");
+  std::vector<uint8_t> finished = displayFrame();
+  for (unsigned int i = 0; i < pixelBuffer.getPixelCount(); i++) {
+    referenceBuffer.setPixel(i, pixelBuffer.getPixel(i));
+  }
+
+  CHECK(finished == getReferenceFrame(), "the layer should be gone after the fade");
+}
+
+static void checkCoveredStart() {
+  // Like leaving low power mode: the style is covered by a layer, and the fade starts
+  // just before the cover comes off.
+  transition.setDuration(60000);
+  RainbowStyle covered("Covered", &pixelBuffer);
+  SingleColorStyle incoming("Incoming", Adafruit_NeoPixel::Color(0, 255, 0), &pixelBuffer);
+  covered.setPattern(4);
+  covered.reset();
+  cover.fill(0);
+  cover.setPixel(0, Adafruit_NeoPixel::Color(255, 0, 0));
+  cover.setEnabled(true);
+  std::vector<uint8_t> coveredFrame = displayFrame();
+
+  transition.start();
+  cover.setEnabled(false);
+
+  // Starting again when the new style is picked keeps the covered frame.
+  transition.start();
+  incoming.reset();
+  Host::advanceClock(1000);
+  transition.update();
+  CHECK(displayFrame() == coveredFrame, "the fade didn't start from the covered frame");
+
+  // The frame is frozen while it fades.
+  covered.update();
+  Host::advanceClock(1000);
+  transition.update();
+  CHECK(displayFrame() == coveredFrame, "the frozen frame changed");
+
+  Host::advanceClock(60000000);
+  transition.update();
+  CHECK(!transition.isActive(), "the fade should be over");
+}
+
+int main() {
+  Host::useSimulatedClock(true);
+  pixelBuffer.initialize();
+  pixelBuffer.setGammaCorrection(false);
+  pixelBuffer.setBrightness(255);
+  pixelBuffer.setFrameRate(60);
+  pixelBuffer.setCaptureOutput(&capture);
+  referenceBuffer.initialize();
+  transition.initialize();
+  cover.setEnabled(false);
+  pixelBuffer.addLayer(&cover);
+
+  checkBlendedStart();
+  checkCoveredStart();
+  return finishTest();
+}